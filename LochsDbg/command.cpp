@@ -12,23 +12,21 @@ void ADebugger::DumpInstruction() const
     StdDumpLight("%s", m_currInstPtr->Main.CompleteInstr);
 
     u32 target = 0;
-    const char *mnemonic = m_currInstPtr->Main.Inst.Mnemonic;
     if (m_currInstPtr->Main.Inst.Opcode == 0xff) {
         // CALL or JMP r/m32
-        if (strstr(mnemonic, "jmp") == mnemonic || strstr(mnemonic, "call") == mnemonic)  {
+        if (m_currInstPtr->Is(LX_INST_BRANCH))  {
             target = m_currCpuPtr->ReadOperand32(m_currInstPtr, m_currInstPtr->Main.Argument1, NULL);
         }
 
-    } else if (m_currInstPtr->Main.Inst.Opcode == 0xe8 && strstr(mnemonic, "call") == mnemonic) {
+    } else if (m_currInstPtr->Main.Inst.Opcode == 0xe8 && Instruction::IsCall(m_currInstPtr)) {
         // call rel32
-        target = m_currCpuPtr->EIP + m_currInstPtr->Length + (u32) m_currInstPtr->Aux.op1.immediate;
+        target = m_currCpuPtr->EIP + m_currInstPtr->Length + (u32) m_currInstPtr->Aux.imm1;
         // decode instruction at target
         pbyte codePtr = m_currCpuPtr->GetCodePtr(target);
         Instruction inst;
         LxDecode(codePtr, &inst, target);
 
-        if (inst.Main.Inst.Opcode == 0xff && 
-            (strstr(inst.Main.Inst.Mnemonic, "jmp") == inst.Main.Inst.Mnemonic)) {
+        if (Instruction::IsIndirectJump(&inst)) {
             target = m_currCpuPtr->ReadOperand32(&inst, inst.Main.Argument1, NULL);
         } else {
             target = 0;
@@ -99,11 +99,7 @@ void Diff::OnProcessorPostExecute( Processor *cpu, const Instruction *inst )
     CONTEXT ctx;
     if (!m_enabled || !m_synced) return;
 
-    bool retReached = 
-        inst->Main.Inst.Opcode == 0xC3 /* RET near */ ||
-        inst->Main.Inst.Opcode == 0xCB /* RET far */ ||
-        inst->Main.Inst.Opcode == 0xC2 /* RET imm16 near */ ||
-        inst->Main.Inst.Opcode == 0xCA /* RET imm16 far */;
+    bool retReached = Instruction::IsRet(inst);
 
     // If last executed instruction is a WinAPI call, we have to skip 
     // this procedure call in the reference process. To do this, keep running the 
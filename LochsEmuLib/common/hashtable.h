@@ -7,71 +7,157 @@
 
 BEGIN_NAMESPACE_LOCHSEMU()
 
-template <typename T, uint Capacity = 0x10000>
+/*
+ * Open-addressing hashtable keyed by uint, with Robin Hood probing
+ * Slots live in one flat array that doubles when 7/8 full; no per-entry allocation
+ * The table owns its items and deletes them on destruction
+ */
+template <typename T, uint InitialCapacity = 0x1000>
 class Hashtable {
+    static_assert((InitialCapacity & (InitialCapacity - 1)) == 0 && InitialCapacity >= 8,
+        "Hashtable capacity must be a power of 2");
 
-    template <typename T> struct Node {
-        Node<T> *   Next;
+    struct Slot {
         uint        Index;
-        T *         Item;
-
-        Node(uint idx, T *i, Node<T> *n) { 
-            Index = idx; Item = i; Next = n; 
-        }
+        uint        Dist;       // distance from the home slot
+        T *         Item;       // NULL if the slot is empty
     };
 
 public:
-    Hashtable()             { ZeroMemory(m_table, Capacity * sizeof(Node<T> *)); }
+    Hashtable();
     virtual ~Hashtable()    { Unload(); }
 
     bool    Insert(uint index, T *item);
-    T *     Lookup(uint index);
-    
+    T *     Lookup(uint index) const;
+    T *     Remove(uint index);     // unlinks the item without deleting it
+    uint    Count() const   { return m_count; }
+
 private:
+    uint    Home(uint index) const { return (index * 0x9e3779b9u) >> m_shift; }
+    void    Place(uint index, T *item);
+    void    Grow();
     void    Unload();
-    void    UnloadNode(Node<T> *&node);
+
 private:
-    Node<T> *   m_table[Capacity];
+    Slot *      m_slots;
+    uint        m_capacity;
+    uint        m_mask;
+    uint        m_shift;
+    uint        m_count;
 };
 
-template <typename T, uint Capacity>
-T * LochsEmu::Hashtable<T, Capacity>::Lookup( uint index )
+template <typename T, uint InitialCapacity>
+LochsEmu::Hashtable<T, InitialCapacity>::Hashtable()
 {
-    Node<T> *ptr = m_table[index % Capacity];
-    while (ptr) {
-        if (ptr->Index == index) return ptr->Item;
-        ptr = ptr->Next;
+    m_capacity  = InitialCapacity;
+    m_mask      = m_capacity - 1;
+    m_shift     = 32;
+    for (uint c = m_capacity; c > 1; c >>= 1) m_shift--;
+    m_count     = 0;
+    m_slots     = new Slot[m_capacity];
+    ZeroMemory(m_slots, m_capacity * sizeof(Slot));
+}
+
+template <typename T, uint InitialCapacity>
+T * LochsEmu::Hashtable<T, InitialCapacity>::Lookup( uint index ) const
+{
+    uint pos = Home(index);
+    for (uint dist = 0; ; dist++) {
+        const Slot &s = m_slots[pos];
+        // a richer slot means the key would have been placed before it
+        if (s.Item == NULL || s.Dist < dist) return NULL;
+        if (s.Index == index) return s.Item;
+        pos = (pos + 1) & m_mask;
     }
-    return NULL;
 }
 
-template <typename T, uint Capacity>
-bool LochsEmu::Hashtable<T, Capacity>::Insert( uint index, T *item )
+template <typename T, uint InitialCapacity>
+bool LochsEmu::Hashtable<T, InitialCapacity>::Insert( uint index, T *item )
 {
+    Assert(item);
     if (Lookup(index)) return false;
-    uint idxTable = index % Capacity;
-    m_table[idxTable] = new Node<T>(index, item, m_table[idxTable]);
+    if ((m_count + 1) * 8 > m_capacity * 7) {
+        Grow();
+    }
+    Place(index, item);
+    m_count++;
     return true;
 }
 
-template <typename T, uint Capacity>
-void LochsEmu::Hashtable<T, Capacity>::UnloadNode( Node<T> *&node )
+template <typename T, uint InitialCapacity>
+T * LochsEmu::Hashtable<T, InitialCapacity>::Remove( uint index )
+{
+    uint pos = Home(index);
+    for (uint dist = 0; ; dist++) {
+        Slot &s = m_slots[pos];
+        if (s.Item == NULL || s.Dist < dist) return NULL;
+        if (s.Index == index) break;
+        pos = (pos + 1) & m_mask;
+    }
+
+    T *item = m_slots[pos].Item;
+    // shift the following displaced entries one slot back
+    uint next = (pos + 1) & m_mask;
+    while (m_slots[next].Item != NULL && m_slots[next].Dist > 0) {
+        m_slots[pos] = m_slots[next];
+        m_slots[pos].Dist--;
+        pos = next;
+        next = (next + 1) & m_mask;
+    }
+    m_slots[pos].Item = NULL;
+    m_slots[pos].Dist = 0;
+    m_count--;
+    return item;
+}
+
+template <typename T, uint InitialCapacity>
+void LochsEmu::Hashtable<T, InitialCapacity>::Place( uint index, T *item )
 {
-    if (node->Next) {
-        UnloadNode(node->Next);
+    Slot curr = { index, 0, item };
+    uint pos = Home(index);
+    while (true) {
+        Slot &s = m_slots[pos];
+        if (s.Item == NULL) {
+            s = curr;
+            return;
+        }
+        if (s.Dist < curr.Dist) {
+            // take the slot from the richer entry and carry on placing that one
+            Slot t = s; s = curr; curr = t;
+        }
+        pos = (pos + 1) & m_mask;
+        curr.Dist++;
     }
-    SAFE_DELETE(node->Item);
-    SAFE_DELETE(node);
 }
 
-template <typename T, uint Capacity>
-void LochsEmu::Hashtable<T, Capacity>::Unload()
+template <typename T, uint InitialCapacity>
+void LochsEmu::Hashtable<T, InitialCapacity>::Grow()
 {
-    for (uint i = 0; i < Capacity; i++) {
-        if (m_table[i]) {
-            UnloadNode(m_table[i]);
+    Slot *oldSlots      = m_slots;
+    uint oldCapacity    = m_capacity;
+
+    m_capacity  <<= 1;
+    m_mask      = m_capacity - 1;
+    m_shift--;
+    m_slots     = new Slot[m_capacity];
+    ZeroMemory(m_slots, m_capacity * sizeof(Slot));
+
+    for (uint i = 0; i < oldCapacity; i++) {
+        if (oldSlots[i].Item) {
+            Place(oldSlots[i].Index, oldSlots[i].Item);
         }
     }
+    SAFE_DELETE_ARRAY(oldSlots);
+}
+
+template <typename T, uint InitialCapacity>
+void LochsEmu::Hashtable<T, InitialCapacity>::Unload()
+{
+    for (uint i = 0; i < m_capacity; i++) {
+        SAFE_DELETE(m_slots[i].Item);
+    }
+    SAFE_DELETE_ARRAY(m_slots);
+    m_count = 0;
 }
 
 END_NAMESPACE_LOCHSEMU()
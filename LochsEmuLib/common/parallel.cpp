@@ -124,4 +124,88 @@ SyncObjectLock::~SyncObjectLock()
     m_obj.Unlock();
 }
 
+TaskPool::TaskPool( int threads /*= 0*/ )
+{
+    m_tasks     = NULL;
+    m_count     = 0;
+    m_next      = 0;
+    m_pending   = 0;
+    m_stop      = false;
+
+    if (threads <= 0) {
+        SYSTEM_INFO sysInfo;
+        GetSystemInfo(&sysInfo);
+        threads = (int) sysInfo.dwNumberOfProcessors;
+    }
+    // the thread calling Run() is one of them
+    for (int i = 1; i < threads; i++) {
+        HANDLE h = CreateThread(NULL, 0, WorkerRoutine, (LPVOID) this, 0, NULL);
+        if (h == NULL) {
+            LxError("Cannot create task pool thread\n");
+            break;
+        }
+        m_workers.push_back(h);
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    m_stop = true;
+    if (!m_workers.empty())
+        m_wake.Post((int) m_workers.size());
+    for (auto &h : m_workers) {
+        WaitForSingleObject(h, INFINITE);
+        CloseHandle(h);
+    }
+}
+
+DWORD __stdcall TaskPool::WorkerRoutine( LPVOID param )
+{
+    ((TaskPool *) param)->Work();
+    return 0;
+}
+
+void TaskPool::Work()
+{
+    while (true) {
+        m_wake.Wait();
+        if (m_stop) break;
+        while (RunNext()) {}
+    }
+}
+
+/*
+ * A worker woken late may find the batch already drained, which is harmless
+ */
+bool TaskPool::RunNext()
+{
+    Task *task;
+    {
+        MutexCSLock lock(m_lock);
+        if (m_next >= m_count) return false;
+        task = m_tasks[m_next++];
+    }
+    task->Run();
+    if (InterlockedDecrement(&m_pending) == 0)
+        m_done.Post();
+    return true;
+}
+
+void TaskPool::Run( Task **tasks, int count )
+{
+    if (count == 0) return;
+    {
+        MutexCSLock lock(m_lock);
+        m_tasks     = tasks;
+        m_count     = count;
+        m_next      = 0;
+        m_pending   = count;
+    }
+    int helpers = min(count - 1, (int) m_workers.size());
+    if (helpers > 0)
+        m_wake.Post(helpers);
+    while (RunNext()) {}
+    m_done.Wait();
+}
+
 END_NAMESPACE_LOCHSEMU()
\ No newline at end of file
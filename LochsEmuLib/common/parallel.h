@@ -99,6 +99,43 @@ private:
     HANDLE  m_semaphore;
 };
 
+/*
+ * A fixed set of worker threads running batches of independent tasks
+ * Run() hands the tasks of a batch out in order, helps with them on the calling
+ * thread and returns when all of them are done
+ */
+class LX_API TaskPool {
+public:
+    class Task {
+    public:
+        virtual ~Task() {}
+        virtual void    Run() = 0;
+    };
+
+    TaskPool(int threads = 0);      // 0: one thread per processor
+    ~TaskPool();
+
+    int     Threads() const { return (int) m_workers.size() + 1; }
+    void    Run(Task **tasks, int count);
+private:
+    static DWORD __stdcall  WorkerRoutine(LPVOID param);
+    void    Work();
+    bool    RunNext();
+
+    TaskPool(const TaskPool &);
+    TaskPool &operator=(const TaskPool &);
+private:
+    std::vector<HANDLE>     m_workers;
+    MutexCS     m_lock;
+    Semaphore   m_wake;
+    Semaphore   m_done;
+    Task **     m_tasks;
+    int         m_count;
+    int         m_next;
+    LONG        m_pending;
+    bool        m_stop;
+};
+
 
 END_NAMESPACE_LOCHSEMU()
  
@@ -0,0 +1,61 @@
+#include "stdafx.h"
+#include "blockcache.h"
+
+BEGIN_NAMESPACE_LOCHSEMU()
+
+BlockCache::BlockCache()
+{
+    m_epoch = 0;
+}
+
+BlockCache::~BlockCache()
+{
+    ReleaseRetired();
+}
+
+void BlockCache::ReleaseRetired()
+{
+    for (uint i = 0; i < m_retiredInsts.size(); i++) {
+        SAFE_DELETE(m_retiredInsts[i]);
+    }
+    for (uint i = 0; i < m_retiredBlocks.size(); i++) {
+        SAFE_DELETE(m_retiredBlocks[i]);
+    }
+    m_retiredInsts.clear();
+    m_retiredBlocks.clear();
+}
+
+void BlockCache::InsertInst( u32 eip, Instruction *inst )
+{
+    Assert(inst);
+    B( m_insts.Insert(eip, inst) );
+}
+
+void BlockCache::InsertBlock( BasicBlock *block )
+{
+    Assert(block && block->Count > 0);
+    B( m_blocks.Insert(block->Entry, block) );
+}
+
+void BlockCache::InvalidatePage( u32 page )
+{
+    Assert(PAGE_LOW(page) == 0);
+
+    // instructions starting at most 15 bytes before the page may reach into it
+    for (u32 eip = page - LX_MAX_INST_LENGTH; eip != page + LX_PAGE_SIZE; eip++) {
+        Instruction *inst = m_insts.Remove(eip);
+        if (inst) m_retiredInsts.push_back(inst);
+    }
+
+    // a block ends in the page it starts in, except for a straddling last instruction
+    for (u32 entry = page - LX_PAGE_SIZE; entry != page + LX_PAGE_SIZE; entry++) {
+        BasicBlock *block = m_blocks.Lookup(entry);
+        if (block == NULL) continue;
+        if (entry < page && block->End <= page - LX_MAX_INST_LENGTH) continue;
+        m_blocks.Remove(entry);
+        m_retiredBlocks.push_back(block);
+    }
+    m_epoch++;
+}
+
+END_NAMESPACE_LOCHSEMU()
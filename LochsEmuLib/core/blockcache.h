@@ -0,0 +1,97 @@
+#pragma once
+
+#ifndef __CORE_BLOCKCACHE_H__
+#define __CORE_BLOCKCACHE_H__
+
+#include "lochsemu.h"
+#include "processor.h"
+#include "hashtable.h"
+
+BEGIN_NAMESPACE_LOCHSEMU()
+
+#define LX_BLOCK_MAX_INSTS      32
+#define LX_MAX_INST_LENGTH      15
+
+/*
+ * A straight-line run of decoded instructions together with their handlers
+ * A block never crosses a page boundary and ends at the first control transfer
+ */
+struct BasicBlock {
+    u32                     Entry;      // address of the first instruction
+    u32                     End;        // address right after the last instruction
+    uint                    Count;
+    const Instruction *     Insts[LX_BLOCK_MAX_INSTS];
+    Processor::InstHandler  Handlers[LX_BLOCK_MAX_INSTS];
+
+    /*
+     * Chained successors, so that the dispatcher can skip the hashtable
+     * Next[0] is the fall-through block, Next[1] the last taken target
+     * Links made before the last invalidation (see BlockCache::Epoch) are stale
+     */
+    BasicBlock *            Next[2];
+    u32                     ChainEpoch;
+
+    BasicBlock(u32 entry) : Entry(entry), End(entry), Count(0), ChainEpoch(0) {
+        Next[0] = Next[1] = NULL;
+    }
+
+    BasicBlock *    Successor(u32 eip, u32 epoch) {
+        if (ChainEpoch != epoch) {
+            Next[0] = Next[1] = NULL;
+            ChainEpoch = epoch;
+            return NULL;
+        }
+        if (Next[0] && Next[0]->Entry == eip) return Next[0];
+        if (Next[1] && Next[1]->Entry == eip) return Next[1];
+        return NULL;
+    }
+
+    void            Chain(BasicBlock *next, u32 epoch) {
+        if (ChainEpoch != epoch) {
+            Next[0] = Next[1] = NULL;
+            ChainEpoch = epoch;
+        }
+        Next[next->Entry == End ? 0 : 1] = next;
+    }
+};
+
+/*
+ * Translation cache of a processor
+ * Owns every decoded instruction and every basic block built from them
+ */
+class BlockCache {
+public:
+    BlockCache();
+    virtual ~BlockCache();
+
+    Instruction *   LookupInst      (u32 eip)       { return m_insts.Lookup(eip); }
+    void            InsertInst      (u32 eip, Instruction *inst);
+    BasicBlock *    LookupBlock     (u32 eip)       { return m_blocks.Lookup(eip); }
+    void            InsertBlock     (BasicBlock *block);
+
+    /*
+     * Drop every instruction and block decoded from the page at 'page'
+     * Dropped objects stay allocated until ReleaseRetired, since the running
+     * block and plugins may still refer to them
+     */
+    void            InvalidatePage  (u32 page);
+    u32             Epoch           (void) const    { return m_epoch; }
+
+    /*
+     * Free the objects dropped so far
+     * Only safe when no block is executing, i.e. at the outermost Step
+     */
+    bool            HasRetired      (void) const    { return !m_retiredInsts.empty() || !m_retiredBlocks.empty(); }
+    void            ReleaseRetired  (void);
+
+private:
+    Hashtable<Instruction>  m_insts;
+    Hashtable<BasicBlock>   m_blocks;
+    std::vector<Instruction *>  m_retiredInsts;
+    std::vector<BasicBlock *>   m_retiredBlocks;
+    u32                     m_epoch;
+};
+
+END_NAMESPACE_LOCHSEMU()
+
+#endif // __CORE_BLOCKCACHE_H__
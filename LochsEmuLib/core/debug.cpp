@@ -20,12 +20,11 @@ void LX_API LochsDebuggingRoutine()
     LxDebug("sizeof(Instruction) = %d\n", sizeof(Instruction));
     LxDebug("sizeof(UIntPtr) = %d\n", sizeof(UIntPtr));
     LxDebug("sizeof(DISASM) = %d\n", sizeof(DISASM));
-    LxDebug("sizeof(INSTRUCTION) = %d\n", sizeof(INSTRUCTION));
+    LxDebug("sizeof(InstAux) = %d\n", sizeof(InstAux));
     LxDebug("sizeof(INSTRTYPE) = %d\n", sizeof(INSTRTYPE));
     LxDebug("sizeof(ARGTYPE) = %d\n", sizeof(ARGTYPE));
     LxDebug("sizeof(PREFIXINFO) = %d\n", sizeof(PREFIXINFO));
-    LxDebug("sizeof(INST) = %d\n", sizeof(INST));
-    LxDebug("sizeof(OPERAND) = %d\n", sizeof(OPERAND));
+    LxDebug("sizeof(InstOperand) = %d\n", sizeof(InstOperand));
     LxDebug("sizeof(DEBUG_EVENT) = %d\n", sizeof(DEBUG_EVENT));
 }
 
@@ -7,6 +7,7 @@
 #include "pluginmgr.h"
 #include "config.h"
 #include "refproc.h"
+#include "heap.h"
 
 BEGIN_NAMESPACE_LOCHSEMU()
 
@@ -25,6 +26,12 @@ LxResult Emulator::Initialize()
     LxDebug("Initializing Emulator\n");
     m_loaded                = false;
 
+#ifdef _DEBUG
+    if (!Heap::SelfTest()) {
+        LxFatal("Heap self test failed\n");
+    }
+#endif
+
     V( m_loader.Initialize(this) );
     V( m_pluginManager.Initialize() );
 
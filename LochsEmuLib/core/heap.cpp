@@ -4,6 +4,35 @@
 
 BEGIN_NAMESPACE_LOCHSEMU()
 
+/*
+ * Block sizes of the small size classes; spacing grows with the size
+ * so that no more than 25% of a block is wasted
+ */
+static const u32 s_classSize[LX_HEAP_SIZE_CLASSES] = {
+    16,     32,     48,     64,     80,     96,     112,    128,
+    160,    192,    224,    256,    320,    384,    448,    512,
+    640,    768,    896,    1024,   1280,   1536,   1792,   2048,
+};
+
+/*
+ * Size class of every size, in units of LX_HEAP_GRANULARITY
+ */
+static struct SizeClassTable {
+    u8      Class[LX_HEAP_MAX_SMALL / LX_HEAP_GRANULARITY + 1];
+
+    SizeClassTable() {
+        uint cls = 0;
+        for (uint i = 0; i <= LX_HEAP_MAX_SMALL / LX_HEAP_GRANULARITY; i++) {
+            while (s_classSize[cls] < i * LX_HEAP_GRANULARITY) cls++;
+            Class[i] = (u8) cls;
+        }
+    }
+
+    uint    Of(u32 size) const {
+        return Class[(size + LX_HEAP_GRANULARITY - 1) / LX_HEAP_GRANULARITY];
+    }
+} s_sizeClass;
+
 
 Heap::Heap( u32 base, u32 reserve, u32 commit, uint nModule )
 : Section(SectionDesc("heap", nModule), base, reserve)
@@ -14,6 +43,8 @@ Heap::Heap( u32 base, u32 reserve, u32 commit, uint nModule )
 
     m_map = new uint[m_pages];
     ZeroMemory(m_map, sizeof(uint) * m_pages);
+    ZeroMemory(m_partial, sizeof(m_partial));
+    m_freeRuns[0] = m_pages;
 }
 
 Heap::~Heap()
@@ -23,94 +54,499 @@ Heap::~Heap()
 
 u32 Heap::HeapAlloc( u32 size, uint flags, Processor *cpu )
 {
-    u32 actualSize = RoundUp(size);
-    if (actualSize == 0) return 0;
-    u32 pageSize = PAGE_NUM(actualSize);
-    uint startPage = FindSpace(pageSize);
-    if (startPage > m_pages) {
-        // TODO: cpu exception
-        return 0;
+    // TODO: cpu exception on failure with HEAP_GENERATE_EXCEPTIONS
+    if (size <= LX_HEAP_MAX_SMALL)
+        return AllocSmall(size, flags);
+    return AllocLarge(size);    // freshly committed pages are always zeroed
+}
+
+bool Heap::HeapFree( u32 addr, uint flags, Processor *cpu )
+{
+    if (!Contains(addr)) return false;
+
+    uint page = PAGE_NUM(addr - m_base);
+    if (m_map[page] == LX_HEAP_SMALL_PAGE)
+        return FreeSmall(addr);
+    return FreeLarge(addr);
+}
+
+u32 Heap::HeapRealloc( u32 addr, u32 size, uint flags, Processor *cpu )
+{
+    uint slot;
+    u32 origSize;
+    HeapSmallPage *p = SmallBlock(addr, &slot);
+    if (p) {
+        origSize = p->Sizes[slot] - 1;
+        if (size <= s_classSize[p->Class]) {
+            // still fits in its slot
+            p->Sizes[slot] = (u16) (size + 1);
+            if ((flags & HEAP_ZERO_MEMORY) && size > origSize)
+                ZeroMemory(m_dataPtr + (addr - m_base) + origSize, size - origSize);
+            return addr;
+        }
+    } else {
+        std::map<u32, u32>::iterator iter = m_memBlockSize.find(addr);
+        if (iter == m_memBlockSize.end()) return 0;
+        origSize = iter->second;
+        if (ResizeLarge(addr, size)) {
+            if ((flags & HEAP_ZERO_MEMORY) && size > origSize)
+                ZeroMemory(m_dataPtr + (addr - m_base) + origSize, size - origSize);
+            return addr;
+        }
     }
+    if (flags & HEAP_REALLOC_IN_PLACE_ONLY) return 0;
+
+    u32 newAddr = HeapAlloc(size, flags, cpu);
+    if (newAddr == 0) return 0;
+
+    memcpy(m_dataPtr + (newAddr - m_base), m_dataPtr + (addr - m_base), min(origSize, size));
+
+    if (!HeapFree(addr, 0, cpu)) return 0;
+    return newAddr;
+}
+
+u32 Heap::HeapSize( u32 addr, uint flags, Processor *cpu )
+{
+    uint slot;
+    HeapSmallPage *p = SmallBlock(addr, &slot);
+    if (p) return p->Sizes[slot] - 1;
+
+    std::map<u32, u32>::const_iterator iter = m_memBlockSize.find(addr);
+    if (iter == m_memBlockSize.end()) return (u32) -1;
+    return iter->second;
+}
+
+bool Heap::HeapValidate( u32 addr, uint flags, Processor *cpu )
+{
+    // validating the whole heap always succeeds, the bookkeeping lives on the host
+    if (addr == 0) return true;
+
+    uint slot;
+    return SmallBlock(addr, &slot) != NULL || m_memBlockSize.find(addr) != m_memBlockSize.end();
+}
+
+u32 Heap::AllocSmall( u32 size, uint flags )
+{
+    uint cls = s_sizeClass.Of(size);
+    HeapSmallPage *p = m_partial[cls];
+    if (p == NULL) {
+        uint page = FindSpace(1);
+        if (page > m_pages) return 0;
+        TakeSpace(page, 1);
+
+        u32 pageAddr = PAGE_ADDR(page) + m_base;
+        V( Commit(pageAddr, LX_PAGE_SIZE, PAGE_READWRITE) );
+        m_map[page] = LX_HEAP_SMALL_PAGE;
+        p = new HeapSmallPage(pageAddr, cls, LX_PAGE_SIZE / s_classSize[cls]);
+        B( m_smallPages.Insert(page, p) );
+        LinkPartial(p);
+    }
+
+    uint slot;
+    bool reused = !p->FreeSlots.empty();
+    if (reused) {
+        slot = p->FreeSlots.back();
+        p->FreeSlots.pop_back();
+    } else {
+        slot = p->Fresh++;
+    }
+    p->Sizes[slot] = (u16) (size + 1);
+    if (++p->Live == p->Sizes.size()) UnlinkPartial(p);
+
+    u32 addr = p->Addr + slot * s_classSize[cls];
+    if (reused && (flags & HEAP_ZERO_MEMORY))
+        ZeroMemory(m_dataPtr + (addr - m_base), size);
+    return addr;
+}
+
+bool Heap::FreeSmall( u32 addr )
+{
+    uint slot;
+    HeapSmallPage *p = SmallBlock(addr, &slot);
+    if (p == NULL) return false;
+
+    if (p->Live == p->Sizes.size()) LinkPartial(p);
+    p->Sizes[slot] = 0;
+    p->FreeSlots.push_back((u16) slot);
+    p->Live--;
+
+    // keep the last partial page of a class, so that alloc/free pairs don't recommit it
+    if (p->Live == 0 && (p->Prev || p->Next)) {
+        UnlinkPartial(p);
+        uint page = PAGE_NUM(p->Addr - m_base);
+        m_smallPages.Remove(page);
+        m_map[page] = 0;
+        V( Decommit(p->Addr, LX_PAGE_SIZE) );
+        ReturnSpace(page, 1);
+        SAFE_DELETE(p);
+    }
+    return true;
+}
+
+u32 Heap::AllocLarge( u32 size )
+{
+    uint nPages = PAGE_NUM(RoundUp(size));
+    uint startPage = FindSpace(nPages);
+    if (startPage > m_pages) return 0;
+    TakeSpace(startPage, nPages);
+
     u32 startAddr = PAGE_ADDR(startPage) + m_base;
-    V( Commit(startAddr, actualSize, PAGE_READWRITE) ); // TODO: may change the page flag
+    V( Commit(startAddr, PAGE_ADDR(nPages), PAGE_READWRITE) ); // TODO: may change the page flag
 
-    for (uint i = startPage; i < startPage + pageSize; i++) {
+    for (uint i = startPage; i < startPage + nPages; i++) {
         Assert(m_map[i] == 0);
-        m_map[i] = pageSize;
+        m_map[i] = nPages;
     }
     m_memBlockSize[startAddr] = size;
     return startAddr;
 }
 
-bool Heap::HeapFree( u32 addr, uint flags, Processor *cpu )
+bool Heap::FreeLarge( u32 addr )
 {
-    // addr must be the start of a page
-    if (PAGE_LOW(addr) != 0) return false;
-
-    if (!Contains(addr)) return false;
+    // addr must be the start of a block
+    std::map<u32, u32>::iterator iter = m_memBlockSize.find(addr);
+    if (iter == m_memBlockSize.end()) return false;
+    m_memBlockSize.erase(iter);
 
     uint startPage = PAGE_NUM(addr - m_base);
     uint size = m_map[startPage];
-    if (size == 0) return false;
-
     for (uint i = startPage; i < size+startPage; i++) {
         Assert(m_map[i] == size);
         m_map[i] = 0;
     }
+    ReturnSpace(startPage, size);
     if (LX_FAILED(Decommit(addr, PAGE_ADDR(size))))
         return false;
     return true;
 }
 
-u32 Heap::HeapRealloc( u32 addr, u32 size, uint flags, Processor *cpu )
+bool Heap::ResizeLarge( u32 addr, u32 size )
 {
-    if (PAGE_LOW(addr) != 0) return 0;
-    const u32 actualSize = RoundUp(size);
+    uint startPage  = PAGE_NUM(addr - m_base);
+    uint nPages     = m_map[startPage];
+    uint newPages   = max(PAGE_NUM(RoundUp(size)), 1u);
 
-    if (!Contains(addr)) return 0;
-    if (actualSize == 0) return 0;
-    
-    u32 newAddr = HeapAlloc(actualSize, flags, cpu);
-    if (newAddr == 0) return 0;
+    if (newPages < nPages) {
+        u32 tailAddr = addr + PAGE_ADDR(newPages);
+        for (uint i = startPage + newPages; i < startPage + nPages; i++)
+            m_map[i] = 0;
+        ReturnSpace(startPage + newPages, nPages - newPages);
+        V( Decommit(tailAddr, PAGE_ADDR(nPages - newPages)) );
+    } else if (newPages > nPages) {
+        // free pages right after a block always start a free run
+        std::map<uint, uint>::const_iterator iter = m_freeRuns.find(startPage + nPages);
+        if (iter == m_freeRuns.end() || iter->second < newPages - nPages) return false;
+        TakeSpace(startPage + nPages, newPages - nPages);
+        V( Commit(addr + PAGE_ADDR(nPages), PAGE_ADDR(newPages - nPages), PAGE_READWRITE) );
+    }
+    for (uint i = startPage; i < startPage + newPages; i++)
+        m_map[i] = newPages;
+    m_memBlockSize[addr] = size;
+    return true;
+}
+
+uint Heap::FindSpace( uint nPages )
+{
+    // first fit over the free runs
+    for (std::map<uint, uint>::const_iterator iter = m_freeRuns.begin();
+        iter != m_freeRuns.end(); ++iter) {
+        if (iter->second >= nPages) return iter->first;
+    }
+    return m_pages + 1;
+}
 
-    const u32 origSize = PAGE_ADDR(m_map[PAGE_NUM(addr-m_base)]);
+void Heap::TakeSpace( uint startPage, uint nPages )
+{
+    std::map<uint, uint>::iterator iter = m_freeRuns.upper_bound(startPage);
+    Assert(iter != m_freeRuns.begin());
+    --iter;
+    uint runStart   = iter->first;
+    uint runEnd     = iter->first + iter->second;
+    Assert(startPage + nPages <= runEnd);
 
-    memcpy(m_dataPtr + (newAddr - m_base), m_dataPtr + (addr - m_base), min(origSize, actualSize));
+    m_freeRuns.erase(iter);
+    if (runStart < startPage)
+        m_freeRuns[runStart] = startPage - runStart;
+    if (startPage + nPages < runEnd)
+        m_freeRuns[startPage + nPages] = runEnd - startPage - nPages;
+}
 
-    if (!HeapFree(addr, 0, cpu)) return 0;
-    return newAddr;
+void Heap::ReturnSpace( uint startPage, uint nPages )
+{
+    std::map<uint, uint>::iterator next = m_freeRuns.find(startPage + nPages);
+    if (next != m_freeRuns.end()) {
+        nPages += next->second;
+        m_freeRuns.erase(next);
+    }
+    std::map<uint, uint>::iterator prev = m_freeRuns.lower_bound(startPage);
+    if (prev != m_freeRuns.begin()) {
+        --prev;
+        if (prev->first + prev->second == startPage) {
+            prev->second += nPages;
+            return;
+        }
+    }
+    m_freeRuns[startPage] = nPages;
 }
 
-u32 Heap::HeapSize( u32 addr, uint flags, Processor *cpu )
+HeapSmallPage * Heap::SmallBlock( u32 addr, uint *slot ) const
 {
-    Assert(m_memBlockSize.find(addr) != m_memBlockSize.end());
-    return m_memBlockSize[addr];
-//     if (PAGE_LOW(addr) != 0) return 0;
-//     uint page = PAGE_NUM(addr - m_base);
-//     return m_map[page];
+    if (!Contains(addr)) return NULL;
+    uint page = PAGE_NUM(addr - m_base);
+    if (m_map[page] != LX_HEAP_SMALL_PAGE) return NULL;
+
+    HeapSmallPage *p = m_smallPages.Lookup(page);
+    Assert(p);
+    u32 offset = PAGE_LOW(addr);
+    if (offset % s_classSize[p->Class] != 0) return NULL;
+    *slot = offset / s_classSize[p->Class];
+    if (*slot >= p->Sizes.size() || p->Sizes[*slot] == 0) return NULL;
+    return p;
 }
 
-bool Heap::HeapValidate( u32 addr, uint flags, Processor *cpu )
+void Heap::LinkPartial( HeapSmallPage *page )
 {
-    LxWarning("Heap::HeapValidate()\n");
-    return true;
+    page->Prev = NULL;
+    page->Next = m_partial[page->Class];
+    if (page->Next) page->Next->Prev = page;
+    m_partial[page->Class] = page;
 }
 
-uint Heap::FindSpace( uint nPages )
+void Heap::UnlinkPartial( HeapSmallPage *page )
 {
-    uint ptr = 0;
-    uint contBlocks = 0;
-    while (ptr < m_pages) {
-        if (m_map[ptr] == 0) {
-            contBlocks++;
-            ptr++;
-            if (contBlocks == nPages) return ptr - nPages;
+    if (page->Prev) page->Prev->Next = page->Next;
+    else m_partial[page->Class] = page->Next;
+    if (page->Next) page->Next->Prev = page->Prev;
+    page->Prev = page->Next = NULL;
+}
+
+bool Heap::CheckConsistency( uint *freePages ) const
+{
+    uint free = 0, end = 0;
+    bool first = true;
+    for (std::map<uint, uint>::const_iterator iter = m_freeRuns.begin();
+        iter != m_freeRuns.end(); ++iter) {
+        // adjacent runs should have been merged
+        if (iter->second == 0 || (!first && iter->first <= end)) return false;
+        if (iter->first + iter->second > m_pages) return false;
+        for (uint i = iter->first; i < iter->first + iter->second; i++)
+            if (m_map[i] != 0) return false;
+        free += iter->second;
+        end = iter->first + iter->second;
+        first = false;
+    }
+
+    uint mapFree = 0;
+    uint emptySmall[LX_HEAP_SIZE_CLASSES];
+    ZeroMemory(emptySmall, sizeof(emptySmall));
+    for (uint i = 0; i < m_pages; ) {
+        if (m_map[i] == 0) {
+            mapFree++;
+            i++;
+        } else if (m_map[i] == LX_HEAP_SMALL_PAGE) {
+            HeapSmallPage *p = m_smallPages.Lookup(i);
+            if (p == NULL) return false;
+            if (p->Live == 0 && ++emptySmall[p->Class] > 1) return false;
+            i++;
         } else {
-            contBlocks = 0;
-            ptr += m_map[ptr];
+            uint n = m_map[i];
+            if (m_memBlockSize.find(m_base + PAGE_ADDR(i)) == m_memBlockSize.end()) return false;
+            for (uint j = i; j < i + n; j++)
+                if (j >= m_pages || m_map[j] != n) return false;
+            i += n;
         }
     }
-    return m_pages + 1;
+    if (mapFree != free) return false;
+    if (freePages) *freePages = free;
+    return true;
+}
+
+/*
+ * Self test
+ */
+
+#define HEAP_CHECK(cond) \
+    if (!(cond)) { LxError("Heap self test failed at line %d: %s\n", __LINE__, #cond); return false; }
+
+static const u32 TestBase      = 0x10000000;
+static const u32 TestReserve   = 256 * LX_PAGE_SIZE;
+
+/*
+ * Freed runs merge back into one as long as nothing else holds pages
+ */
+static bool TestCoalesce()
+{
+    Heap heap(TestBase, TestReserve, 0, 0);
+    u32 a = heap.HeapAlloc(3 * LX_PAGE_SIZE, 0, NULL);
+    u32 b = heap.HeapAlloc(2 * LX_PAGE_SIZE, 0, NULL);
+    u32 c = heap.HeapAlloc(5 * LX_PAGE_SIZE, 0, NULL);
+    u32 d = heap.HeapAlloc(LX_PAGE_SIZE + 1, 0, NULL);
+    HEAP_CHECK(a && b == a + 3 * LX_PAGE_SIZE && c == b + 2 * LX_PAGE_SIZE && d == c + 5 * LX_PAGE_SIZE);
+
+    // a hole between two blocks, then merging with the run before, after and both
+    HEAP_CHECK(heap.HeapFree(b, 0, NULL));
+    HEAP_CHECK(heap.HeapAlloc(2 * LX_PAGE_SIZE, 0, NULL) == b);
+    HEAP_CHECK(heap.HeapFree(b, 0, NULL));
+    HEAP_CHECK(heap.HeapFree(a, 0, NULL));
+    HEAP_CHECK(heap.HeapAlloc(5 * LX_PAGE_SIZE, 0, NULL) == a);
+    HEAP_CHECK(heap.HeapFree(a, 0, NULL));
+    HEAP_CHECK(heap.HeapFree(d, 0, NULL));
+    HEAP_CHECK(heap.HeapFree(c, 0, NULL));
+    HEAP_CHECK(heap.CheckConsistency(NULL));
+    HEAP_CHECK(heap.HeapAlloc(TestReserve, 0, NULL) == TestBase);
+    return true;
 }
 
-END_NAMESPACE_LOCHSEMU()
\ No newline at end of file
+/*
+ * Large blocks grow into the pages right after them and shrink in place
+ */
+static bool TestResizeLarge()
+{
+    Heap heap(TestBase, TestReserve, 0, 0);
+    u32 a = heap.HeapAlloc(2 * LX_PAGE_SIZE, 0, NULL);
+    pbyte data = heap.GetRawData(a);
+    memset(data, 0x5a, 2 * LX_PAGE_SIZE);
+
+    HEAP_CHECK(heap.HeapRealloc(a, 4 * LX_PAGE_SIZE, HEAP_REALLOC_IN_PLACE_ONLY, NULL) == a);
+    HEAP_CHECK(heap.HeapSize(a, 0, NULL) == 4 * LX_PAGE_SIZE);
+    HEAP_CHECK(data[2 * LX_PAGE_SIZE - 1] == 0x5a && data[2 * LX_PAGE_SIZE] == 0);
+
+    // blocked by a neighbour, so it can only move
+    u32 b = heap.HeapAlloc(LX_PAGE_SIZE + 1, 0, NULL);
+    HEAP_CHECK(b == a + 4 * LX_PAGE_SIZE);
+    HEAP_CHECK(heap.HeapRealloc(a, 5 * LX_PAGE_SIZE, HEAP_REALLOC_IN_PLACE_ONLY, NULL) == 0);
+    HEAP_CHECK(heap.HeapSize(a, 0, NULL) == 4 * LX_PAGE_SIZE);
+    u32 moved = heap.HeapRealloc(a, 5 * LX_PAGE_SIZE, 0, NULL);
+    HEAP_CHECK(moved != 0 && moved != a && heap.GetRawData(moved)[0] == 0x5a);
+    HEAP_CHECK(heap.HeapSize(a, 0, NULL) == (u32) -1);
+
+    // the tail given back by shrinking is reused, once the hole left by a is filled
+    HEAP_CHECK(heap.HeapRealloc(moved, LX_PAGE_SIZE + 100, 0, NULL) == moved);
+    HEAP_CHECK(heap.HeapSize(moved, 0, NULL) == LX_PAGE_SIZE + 100);
+    HEAP_CHECK(heap.HeapAlloc(4 * LX_PAGE_SIZE, 0, NULL) == a);
+    HEAP_CHECK(heap.HeapAlloc(3 * LX_PAGE_SIZE, 0, NULL) == moved + 2 * LX_PAGE_SIZE);
+    HEAP_CHECK(heap.CheckConsistency(NULL));
+    return true;
+}
+
+/*
+ * Emptied small pages are released, except the last partial one of each class,
+ * and reused slots honour HEAP_ZERO_MEMORY
+ */
+static bool TestSmallPages()
+{
+    Heap heap(TestBase, TestReserve, 0, 0);
+    const uint perPage = LX_PAGE_SIZE / 16;
+    std::vector<u32> blocks;
+    for (uint i = 0; i < perPage * 3; i++) {
+        u32 addr = heap.HeapAlloc(10, 0, NULL);
+        HEAP_CHECK(addr != 0);
+        memset(heap.GetRawData(addr), 0xcc, 10);
+        blocks.push_back(addr);
+    }
+    for (uint i = 0; i < blocks.size(); i++)
+        HEAP_CHECK(heap.HeapFree(blocks[i], 0, NULL));
+    HEAP_CHECK(!heap.HeapFree(blocks[0], 0, NULL));
+
+    // only the first page of the class is left, the other two went back as one run
+    uint free;
+    HEAP_CHECK(heap.CheckConsistency(&free) && free == PAGE_NUM(TestReserve) - 1);
+    HEAP_CHECK(heap.HeapAlloc(2 * LX_PAGE_SIZE, 0, NULL) == TestBase + LX_PAGE_SIZE);
+
+    // a reused slot still holds what was written to it, unless zeroing is asked for
+    u32 slot = heap.HeapAlloc(16, HEAP_ZERO_MEMORY, NULL);
+    HEAP_CHECK(PAGE_HIGH(slot) == TestBase);
+    for (uint i = 0; i < 16; i++)
+        HEAP_CHECK(heap.GetRawData(slot)[i] == 0);
+    memset(heap.GetRawData(slot), 0xcc, 16);
+    HEAP_CHECK(heap.HeapFree(slot, 0, NULL));
+    HEAP_CHECK(heap.HeapAlloc(16, HEAP_ZERO_MEMORY, NULL) == slot);
+    HEAP_CHECK(heap.GetRawData(slot)[0] == 0 && heap.GetRawData(slot)[15] == 0);
+    return true;
+}
+
+/*
+ * Random operations against a model of the live blocks
+ */
+static bool TestRandom()
+{
+    Heap heap(TestBase, TestReserve, 0, 0);
+    std::map<u32, u32> live;        // address -> size
+    std::map<u32, byte> fill;       // address -> byte every data byte holds
+
+    for (int round = 0; round < 20000; round++) {
+        int op = rand() % 3;
+        u32 size = rand() % 4 == 0 ? rand() % (4 * LX_PAGE_SIZE) : rand() % (LX_HEAP_MAX_SMALL + 1);
+        uint flags = rand() % 2 ? HEAP_ZERO_MEMORY : 0;
+
+        if (op == 0 || live.empty()) {
+            u32 addr = heap.HeapAlloc(size, flags, NULL);
+            if (addr == 0) continue;    // full
+            HEAP_CHECK(live.find(addr) == live.end());
+            HEAP_CHECK(heap.HeapSize(addr, 0, NULL) == size);
+            pbyte data = heap.GetRawData(addr);
+            if (flags & HEAP_ZERO_MEMORY) {
+                for (u32 i = 0; i < size; i++) HEAP_CHECK(data[i] == 0);
+            }
+            byte b = (byte) (1 + rand() % 255);
+            memset(data, b, size);
+            live[addr] = size;
+            fill[addr] = b;
+            continue;
+        }
+
+        std::map<u32, u32>::iterator iter = live.begin();
+        std::advance(iter, rand() % live.size());
+        u32 addr = iter->first, oldSize = iter->second;
+        byte b = fill[addr];
+        if (op == 1) {
+            HEAP_CHECK(heap.HeapFree(addr, 0, NULL));
+            HEAP_CHECK(heap.HeapSize(addr, 0, NULL) == (u32) -1);
+            live.erase(iter);
+            fill.erase(addr);
+            continue;
+        }
+
+        u32 newAddr = heap.HeapRealloc(addr, size, flags, NULL);
+        if (newAddr == 0) continue;     // full, the block stays
+        HEAP_CHECK(heap.HeapSize(newAddr, 0, NULL) == size);
+        pbyte data = heap.GetRawData(newAddr);
+        for (u32 i = 0; i < min(size, oldSize); i++) HEAP_CHECK(data[i] == b);
+        if (flags & HEAP_ZERO_MEMORY) {
+            for (u32 i = oldSize; i < size; i++) HEAP_CHECK(data[i] == 0);
+        }
+        memset(data, b, size);
+        live.erase(iter);
+        fill.erase(addr);
+        HEAP_CHECK(live.find(newAddr) == live.end());
+        live[newAddr] = size;
+        fill[newAddr] = b;
+
+        if (round % 256 != 0) continue;
+        // no two blocks overlap, and none was written through another
+        HEAP_CHECK(heap.CheckConsistency(NULL));
+        u32 end = 0;
+        for (iter = live.begin(); iter != live.end(); ++iter) {
+            HEAP_CHECK(iter->first >= end);
+            end = iter->first + max(iter->second, 1u);
+            pbyte p = heap.GetRawData(iter->first);
+            for (u32 i = 0; i < iter->second; i++) HEAP_CHECK(p[i] == fill[iter->first]);
+        }
+    }
+
+    for (std::map<u32, u32>::iterator iter = live.begin(); iter != live.end(); ++iter)
+        HEAP_CHECK(heap.HeapFree(iter->first, 0, NULL));
+    // at most one small page per class is left, every other page is free again
+    uint free;
+    HEAP_CHECK(heap.CheckConsistency(&free));
+    HEAP_CHECK(free >= PAGE_NUM(TestReserve) - LX_HEAP_SIZE_CLASSES);
+    return true;
+}
+
+bool Heap::SelfTest()
+{
+    return TestCoalesce() && TestResizeLarge() && TestSmallPages() && TestRandom();
+}
+
+
+END_NAMESPACE_LOCHSEMU()
@@ -5,9 +5,33 @@
 
 #include "lochsemu.h"
 #include "section.h"
+#include "hashtable.h"
 
 BEGIN_NAMESPACE_LOCHSEMU()
 
+#define LX_HEAP_GRANULARITY     16
+#define LX_HEAP_MAX_SMALL       2048        // larger blocks take whole pages
+#define LX_HEAP_SIZE_CLASSES    24
+#define LX_HEAP_SMALL_PAGE      0xffffffff  // m_map value of a page carved into small blocks
+
+/*
+ * A page carved into equally sized blocks of one size class
+ * Bookkeeping stays on the host, so that the guest can't corrupt it
+ */
+struct HeapSmallPage {
+    u32                 Addr;
+    uint                Class;
+    uint                Live;       // allocated blocks
+    uint                Fresh;      // first slot never handed out
+    std::vector<u16>    FreeSlots;  // slots freed since
+    std::vector<u16>    Sizes;      // requested size + 1 of each slot; 0 if free
+    HeapSmallPage *     Prev;       // links in the partial list of the class
+    HeapSmallPage *     Next;
+
+    HeapSmallPage(u32 addr, uint cls, uint slots)
+        : Addr(addr), Class(cls), Live(0), Fresh(0), Sizes(slots, 0), Prev(NULL), Next(NULL) {}
+};
+
 class LX_API Heap : public Section {
 public:
     Heap(u32 base, u32 reserve, u32 commit, uint nModule);
@@ -18,16 +42,43 @@ public:
     u32     HeapRealloc(u32 addr, u32 size, uint flags, Processor *cpu);
     u32     HeapSize(u32 addr, uint flags, Processor *cpu);
     bool    HeapValidate(u32 addr, uint flags, Processor *cpu);
+
+    /*
+     * Check the page map against the free runs (fully merged) and the blocks,
+     * optionally returning the number of free pages
+     */
+    bool    CheckConsistency(uint *freePages) const;
+
+    /*
+     * Drive a scratch heap through alloc/free/realloc sequences and check
+     * sizes, overlaps, contents and the free run bookkeeping
+     */
+    static bool SelfTest();
 private:
+    u32     AllocSmall(u32 size, uint flags);
+    bool    FreeSmall(u32 addr);
+    u32     AllocLarge(u32 size);
+    bool    FreeLarge(u32 addr);
+    bool    ResizeLarge(u32 addr, u32 size);
+
     /*
      * Find next continuous pages available;
      * if found, retval = page starting number;
      * if not found, retval = n > m_pages
      */
-    uint FindSpace(uint nPages);
+    uint    FindSpace(uint nPages);
+    void    TakeSpace(uint startPage, uint nPages);
+    void    ReturnSpace(uint startPage, uint nPages);
+
+    HeapSmallPage * SmallBlock(u32 addr, uint *slot) const;
+    void    LinkPartial(HeapSmallPage *page);
+    void    UnlinkPartial(HeapSmallPage *page);
 private:
-    uint *m_map;
-    std::map<u32, u32>  m_memBlockSize; // Preserve the size of each memory block
+    uint *m_map;    // 0 if free, LX_HEAP_SMALL_PAGE or the page count of the large block
+    std::map<u32, u32>  m_memBlockSize; // Preserve the size of each large memory block
+    std::map<uint, uint>        m_freeRuns;     // start page -> page count
+    Hashtable<HeapSmallPage>    m_smallPages;   // by page number
+    HeapSmallPage *     m_partial[LX_HEAP_SIZE_CLASSES];    // pages with free slots
 };
 
 END_NAMESPACE_LOCHSEMU()
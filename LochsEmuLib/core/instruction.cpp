@@ -4,49 +4,187 @@
 BEGIN_NAMESPACE_LOCHSEMU()
 
 
-bool Instruction::IsRet( const Instruction *inst )
+static bool IsPrefix( u8 b )
 {
-    u32 opcode = inst->Main.Inst.Opcode;
-    return opcode == 0xc3 || opcode == 0xcb || opcode == 0xc2 || opcode == 0xca;
+    switch (b) {
+    case 0xf0: case 0xf2: case 0xf3:
+    case 0x2e: case 0x36: case 0x3e: case 0x26: case 0x64: case 0x65:
+    case 0x66: case 0x67:
+        return true;
+    default:
+        return false;
+    }
 }
 
-bool Instruction::IsCall( const Instruction *inst )
+static u32 ReadImm( cpbyte p, int bytes )
 {
-    const char *m= inst->Main.Inst.Mnemonic;
-    /*return strstr(mnemonics, "call") == mnemonics;*/
-    return m[0] == 'c' && m[1] == 'a' && m[2] == 'l';
+    u32 val = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        val = (val << 8) | p[i];
+    }
+    return val;
 }
 
-bool Instruction::IsConditionalJump( const Instruction *inst )
+static void ResolveOperand( const ARGTYPE &arg, InstOperand *op )
 {
-    u32 op = inst->Main.Inst.Opcode;
-    return (op >= 0x70 && op < 0x80) || (op >= 0x0f80 && op < 0x0f90) || 
-        (op == 0xe2) || (op == 0xe3);
+    op->Kind    = LX_OPERAND_OTHER;
+    op->Reg     = op->Reg8 = LX_OPERAND_NOREG;
+    op->Base    = op->Index = LX_OPERAND_NOREG;
+    op->Scale   = 0;
+    op->Disp    = 0;
+
+    if (IsNoArg(arg)) {
+        op->Kind = LX_OPERAND_NONE;
+    } else if (IsRegArg(arg)) {
+        u32 mask = REG_NUM(arg.ArgType);
+        // implicit operands of mul/div, pushad and the like combine several registers
+        bool single = mask != 0 && (mask & (mask - 1)) == 0 && mask <= REG7;
+        if (REG_TYPE(arg.ArgType) == (REGISTER_TYPE | GENERAL_REG) && single) {
+            op->Kind = LX_OPERAND_GPR;
+            op->Reg  = (u8) LxRegConvert(mask);
+            if (op->Reg < 4) {
+                op->Reg8 = op->Reg + (arg.ArgPosition ? 4 : 0);
+            }
+        }
+    } else if (IsMemoryArg(arg)) {
+        op->Kind = LX_OPERAND_MEM;
+        op->Disp = (u32) arg.Memory.Displacement;
+        if (arg.Memory.BaseRegister) {
+            op->Base = (u8) LxRegConvert(arg.Memory.BaseRegister);
+        }
+        if (arg.Memory.IndexRegister) {
+            op->Index = (u8) LxRegConvert(arg.Memory.IndexRegister);
+            op->Scale = (u8) arg.Memory.Scale;
+        }
+    } else if (IsConstantArg(arg)) {
+        op->Kind = LX_OPERAND_IMM;
+    }
 }
 
-bool Instruction::IsIndirectJump( const Instruction *inst )
+static bool MnemonicIs( const char *m, const char *prefix )
 {
-    const char *m = inst->Main.Inst.Mnemonic;
-    u32 op = inst->Main.Inst.Opcode;
-    return op == 0xff && m[0] == 'j' && m[1] == 'm' && m[2] == 'p';
+    return strncmp(m, prefix, strlen(prefix)) == 0;
 }
 
-bool Instruction::IsCmp( const Instruction *inst )
+static u32 MemoryAccess( const DISASM &d )
 {
-    const char *m = inst->Main.Inst.Mnemonic;
-    return m[0] == 'c' && m[1] == 'm' && m[2] == 'p';
+    if (d.Inst.Opcode == 0x8d) return 0;    // lea
+    u32 attr = 0;
+    const ARGTYPE *args[] = { &d.Argument1, &d.Argument2, &d.Argument3 };
+    for (int i = 0; i < 3; i++) {
+        if (!IsMemoryArg(*args[i])) continue;
+        if (args[i]->AccessMode & READ)  attr |= LX_INST_MEM_READ;
+        if (args[i]->AccessMode & WRITE) attr |= LX_INST_MEM_WRITE;
+    }
+    return attr;
 }
 
-bool Instruction::IsPop( const Instruction *inst )
+void Instruction::Classify( void )
 {
-    const char *m = inst->Main.Inst.Mnemonic;
-    return m[0] == 'p' && m[1] == 'o' && m[2] == 'p';
+    const char *m   = Main.Inst.Mnemonic;
+    u32 op          = Main.Inst.Opcode;
+    u32 category    = Main.Inst.Category;
+
+    Class   = LX_CLASS_OTHER;
+    Attr    = MemoryAccess(Main);
+
+    if (category & FPU_INSTRUCTION) {
+        Class = LX_CLASS_FPU;
+    } else if (category & (MMX_INSTRUCTION | SSE_INSTRUCTION | SSE2_INSTRUCTION | SSE3_INSTRUCTION | 
+        SSSE3_INSTRUCTION | SSE41_INSTRUCTION | SSE42_INSTRUCTION | AES_INSTRUCTION | CLMUL_INSTRUCTION)) {
+        Class = LX_CLASS_SIMD;
+    } else if (category & SYSTEM_INSTRUCTION) {
+        Class = LX_CLASS_SYSTEM;
+    } else {
+        switch (INST_TYPE(category)) {
+        case DATA_TRANSFER:             Class = LX_CLASS_MOV;       break;
+        case ARITHMETIC_INSTRUCTION:    Class = LX_CLASS_ARITH;     break;
+        case LOGICAL_INSTRUCTION:       Class = LX_CLASS_LOGIC;     break;
+        case SHIFT_ROTATE:              Class = LX_CLASS_SHIFT;     break;
+        case BIT_UInt8:                 Class = LX_CLASS_BIT;       break;
+        case STRING_INSTRUCTION:        Class = LX_CLASS_STRING;    break;
+        }
+    }
+
+    if (INST_TYPE(category) == STRING_INSTRUCTION) {
+        Attr |= LX_INST_STRING;
+        if (Main.Prefix.RepPrefix == InUsePrefix || Main.Prefix.RepnePrefix == InUsePrefix) {
+            Attr |= LX_INST_REP;
+        }
+    }
+
+    if (MnemonicIs(m, "cmp")) {
+        Attr |= LX_INST_CMP;
+        if (Class != LX_CLASS_STRING) Class = LX_CLASS_CMP;
+    } else if (MnemonicIs(m, "tes")) {
+        Attr |= LX_INST_TEST;
+        Class = LX_CLASS_TEST;
+    } else if (MnemonicIs(m, "push")) {
+        Attr |= LX_INST_PUSH | LX_INST_MEM_WRITE;
+        Class = LX_CLASS_PUSH;
+    } else if (MnemonicIs(m, "pop")) {
+        Attr |= LX_INST_POP | LX_INST_MEM_READ;
+        Class = LX_CLASS_POP;
+    }
+
+    if (MnemonicIs(m, "cal")) {
+        Attr |= LX_INST_BRANCH | LX_INST_CALL | LX_INST_MEM_WRITE;
+        Class = LX_CLASS_CALL;
+    } else if (op == 0xc3 || op == 0xcb || op == 0xc2 || op == 0xca) {
+        Attr |= LX_INST_BRANCH | LX_INST_RET | LX_INST_MEM_READ;
+        Class = LX_CLASS_RET;
+    } else if ((op >= 0x70 && op < 0x80) || (op >= 0x0f80 && op < 0x0f90) || 
+        op == 0xe2 || op == 0xe3) {
+        Attr |= LX_INST_BRANCH | LX_INST_CONDITIONAL;
+        Class = LX_CLASS_JCC;
+    } else if (MnemonicIs(m, "jmp")) {
+        Attr |= LX_INST_BRANCH;
+        Class = LX_CLASS_JMP;
+    } else if (Main.Inst.BranchType != 0 || INST_TYPE(category) == CONTROL_TRANSFER) {
+        Attr |= LX_INST_BRANCH;
+    }
+
+    if ((Attr & LX_INST_BRANCH) && op == 0xff) {
+        Attr |= LX_INST_INDIRECT;
+    }
 }
 
-bool Instruction::IsCmpOrTest( const Instruction *inst )
+void Instruction::Resolve( cpbyte data )
 {
-    const char *m = inst->Main.Inst.Mnemonic;
-    return IsCmp(inst) || (m[0] == 't' && m[1] == 'e' && m[2] == 's');
+    ZeroMemory(&Aux, sizeof(InstAux));
+    Classify();
+
+    ResolveOperand(Main.Argument1, &Ops[0]);
+    ResolveOperand(Main.Argument2, &Ops[1]);
+    ResolveOperand(Main.Argument3, &Ops[2]);
+
+    int p = 0;
+    while (p < Length && IsPrefix(data[p])) p++;
+    if (p >= Length) return;
+
+    u8 op = data[p++];
+    if (op == 0x0f && p < Length) {
+        u8 op2 = data[p++];
+        if ((op2 == 0x38 || op2 == 0x3a) && p < Length) p++;
+        if (op2 >= 0x80 && op2 < 0x90) {
+            // jcc rel16/32
+            Aux.imm1 = ReadImm(data + p, Length - p);
+            return;
+        }
+    }
+    if (p < Length) {
+        Aux.modrm = data[p];
+    }
+
+    if (op == 0xe8 || op == 0xe9 || op == 0xeb ||
+        (op >= 0x70 && op < 0x80) || (op >= 0xe0 && op <= 0xe3)) {
+        // call, jmp, jcc, loop, jecxz with a relative offset
+        Aux.imm1 = ReadImm(data + p, Length - p);
+    } else if (op == 0xc8 && Length - p == 3) {
+        // enter imm16, imm8
+        Aux.imm1 = ReadImm(data + p, 2);
+        Aux.imm2 = data[p + 2];
+    }
 }
 
 END_NAMESPACE_LOCHSEMU()
\ No newline at end of file
@@ -5,33 +5,141 @@
 
 #include "lochsemu.h"
 
-#include "3rdparty/libdasm/libdasm.h"
-
 #define BEA_ENGINE_STATIC
 #define BEA_USE_STDCALL
 #include "3rdparty/BeaEngine/BeaEngine.h"
 
 BEGIN_NAMESPACE_LOCHSEMU()
 
+#define MASK_MODRM_MOD(x)   (((x) & 0xc0) >> 6)
+#define MASK_MODRM_REG(x)   (((x) & 0x38) >> 3)
+#define MASK_MODRM_RM(x)    ((x) & 0x7)
+
+// Kinds of operands resolved at decode time
+#define LX_OPERAND_NONE     0
+#define LX_OPERAND_GPR      1   // general purpose register
+#define LX_OPERAND_MEM      2
+#define LX_OPERAND_IMM      3
+#define LX_OPERAND_OTHER    4   // anything else; handled through ARGTYPE
+
+// Register index of an absent base/index register; maps onto the fixed zero register
+#define LX_OPERAND_NOREG    8
+
+// Opcode classes assigned at decode time
+enum InstClass {
+    LX_CLASS_OTHER = 0,
+    LX_CLASS_MOV,
+    LX_CLASS_ARITH,
+    LX_CLASS_LOGIC,
+    LX_CLASS_SHIFT,
+    LX_CLASS_BIT,
+    LX_CLASS_CMP,
+    LX_CLASS_TEST,
+    LX_CLASS_PUSH,
+    LX_CLASS_POP,
+    LX_CLASS_JMP,
+    LX_CLASS_JCC,
+    LX_CLASS_CALL,
+    LX_CLASS_RET,
+    LX_CLASS_STRING,
+    LX_CLASS_FPU,
+    LX_CLASS_SIMD,
+    LX_CLASS_SYSTEM,
+};
+
+// Semantic attributes assigned at decode time
+#define LX_INST_BRANCH      0x0001      // any control transfer
+#define LX_INST_CALL        0x0002
+#define LX_INST_RET         0x0004      // near/far ret, with or without imm16
+#define LX_INST_CONDITIONAL 0x0008      // jcc, jecxz, loop
+#define LX_INST_INDIRECT    0x0010      // target taken from a register or memory
+#define LX_INST_STRING      0x0020
+#define LX_INST_REP         0x0040      // rep/repne prefixed
+#define LX_INST_MEM_READ    0x0080      // reads memory, including the stack
+#define LX_INST_MEM_WRITE   0x0100      // writes memory, including the stack
+#define LX_INST_CMP         0x0200      // cmp, cmps, cmpxchg, ...
+#define LX_INST_TEST        0x0400
+#define LX_INST_PUSH        0x0800
+#define LX_INST_POP         0x1000
+
+/*
+ * An operand resolved once at decode time, so that executing the instruction
+ * doesn't have to re-interpret the BeaEngine ARGTYPE
+ */
+struct InstOperand {
+    u8      Kind;
+    u8      Reg;        // GPR: dword/word register index
+    u8      Reg8;       // GPR: byte register index (AL, CL, DL, BL, AH, CH, DH, BH)
+    u8      Base;       // MEM: base register index
+    u8      Index;      // MEM: index register index
+    u8      Scale;      // MEM
+    u32     Disp;       // MEM
+};
+
+/*
+ * Raw encoding details the handlers need beyond what BeaEngine reports
+ */
+struct InstAux {
+    u8      modrm;      // byte following the opcode; the ModR/M byte if the instruction has one
+    u32     imm1;       // first immediate of branches and ENTER
+    u32     imm2;       // second immediate of ENTER
+};
+
 class LX_API Instruction {
 public:
     Instruction() {
         ZeroMemory(&Main, sizeof(DISASM));
-        ZeroMemory(&Aux, sizeof(INSTRUCTION));
+        ZeroMemory(&Aux, sizeof(InstAux));
+        ZeroMemory(Ops, sizeof(Ops));
+        Class = LX_CLASS_OTHER;
+        Attr = 0;
         Length = 0;
     }
 
-    static bool IsRet(const Instruction *inst);
-    static bool IsCall(const Instruction *inst);
-    static bool IsConditionalJump(const Instruction *inst);
-    static bool IsIndirectJump(const Instruction *inst);
-    static bool IsCmp(const Instruction *inst);
-    static bool IsPop(const Instruction *inst);
-    static bool IsCmpOrTest(const Instruction *inst);
+    /*
+     * Fill in Aux, Ops, Class and Attr after BeaEngine has decoded 'data' into Main
+     */
+    void        Resolve(cpbyte data);
+
+    /*
+     * Derive Class and Attr from Main; called by Resolve
+     */
+    void        Classify(void);
+
+    /*
+     * Resolved operand of one of Main.Argument1/2/3; NULL for a foreign ARGTYPE
+     */
+    const InstOperand * Operand(const ARGTYPE &oper) const {
+        if (&oper == &Main.Argument1) return &Ops[0];
+        if (&oper == &Main.Argument2) return &Ops[1];
+        if (&oper == &Main.Argument3) return &Ops[2];
+        return NULL;
+    }
+
+    bool        Is(u32 attr) const { return (Attr & attr) != 0; }
+
+    static bool IsRet(const Instruction *inst)              { return inst->Is(LX_INST_RET); }
+    static bool IsCall(const Instruction *inst)             { return inst->Is(LX_INST_CALL); }
+    static bool IsConditionalJump(const Instruction *inst)  { return inst->Is(LX_INST_CONDITIONAL); }
+    static bool IsIndirectJump(const Instruction *inst)     {
+        return inst->Class == LX_CLASS_JMP && inst->Is(LX_INST_INDIRECT);
+    }
+    static bool IsDirectJump(const Instruction *inst)       {
+        return inst->Class == LX_CLASS_JMP && !inst->Is(LX_INST_INDIRECT);
+    }
+    static bool IsCmp(const Instruction *inst)              { return inst->Is(LX_INST_CMP); }
+    static bool IsPop(const Instruction *inst)              { return inst->Is(LX_INST_POP); }
+    static bool IsCmpOrTest(const Instruction *inst)        { return inst->Is(LX_INST_CMP | LX_INST_TEST); }
 
     DISASM          Main;  /* BeaEngine */
 
-    INSTRUCTION     Aux;   /* Libdasm */
+    InstAux         Aux;
+
+    InstOperand     Ops[3];
+
+    InstClass       Class;
+
+    u32             Attr;   /* LX_INST_* */
 
     int             Length;
 
@@ -8,7 +8,6 @@
 #define BEA_USE_STDCALL
 #include "../3rdparty/BeaEngine/BeaEngine.h"
 
-#include "../3rdparty/libdasm/libdasm.h"
 #include "instruction.h"
 
 BEGIN_NAMESPACE_LOCHSEMU()
@@ -227,10 +226,10 @@ LX_API bool LxByteToWide( LPCSTR b, LPWSTR w, int len)
 INLINE LX_API bool LxDecode( byte data[], Instruction *inst, u32 eip )
 {
     __try {
-        get_instruction(&inst->Aux, data, MODE_32);
         inst->Main.EIP = (UIntPtr) data;
         inst->Main.VirtualAddr = eip;
         inst->Length = Disasm((LPDISASM) &inst->Main);
+        inst->Resolve(data);
     }
     __except(EXCEPTION_EXECUTE_HANDLER) {
         return false;
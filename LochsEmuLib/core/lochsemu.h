@@ -160,6 +160,8 @@ class   Coprocessor;
 struct  X86SIMD;
 class   Memory;
 class   Instruction;
+struct  BasicBlock;
+class   BlockCache;
 class   PeModule;
 struct  ModuleInfo;
 struct  PageDesc;
@@ -11,16 +11,19 @@ BEGIN_NAMESPACE_LOCHSEMU()
 struct LX_API PageDesc {
     uint    Protect;
     uint    Characristics;
+    bool    HasCode;        // instructions have been decoded from this page
 
     PageDesc() 
     {
         Protect = PAGE_NOACCESS;
         Characristics = LX_CHR_RESERVED;
+        HasCode = false;
     }
     PageDesc(uint protect, uint chr)
     {
         Protect = protect;
         Characristics = chr;
+        HasCode = false;
     }
 };
 
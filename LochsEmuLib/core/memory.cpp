@@ -9,6 +9,8 @@ BEGIN_NAMESPACE_LOCHSEMU()
 LX_API Memory::Memory()
 {
     ZeroMemory(m_sectionTable, sizeof(m_sectionTable));
+    m_codeWriteBase = 0;
+    m_codeWriteCount = 0;
 }
 
 
@@ -195,6 +197,7 @@ void Memory::InsertSection( Section *sec )
         Assert(m_sectionTable[i] == NULL);
         m_sectionTable[i] = sec;
     }
+    sec->m_owner = this;
     m_sections.push_back(sec);
 }
 
@@ -212,6 +215,74 @@ void Memory::RemoveSection( Section *sec )
     m_sections.erase(iter);
 }
 
+LX_API void Memory::MarkCode( u32 address )
+{
+    Section *sec = GetSection(address);
+    if (sec) sec->MarkCode(address);
+}
+
+LX_API u32 Memory::GetCodeWrite( u32 index ) const
+{
+    SyncObjectLock lock(*this);
+    Assert(index >= m_codeWriteBase && index < m_codeWriteCount);
+    return m_codeWrites[index - m_codeWriteBase];
+}
+
+static const u32 CodeReaderFree = 0xffffffff;
+
+LX_API int Memory::AddCodeReader( u32 *index )
+{
+    SyncObjectLock lock(*this);
+    Assert(index);
+
+    // a new reader has nothing decoded yet, so it starts at the end of the log
+    *index = m_codeWriteCount;
+    for (uint i = 0; i < m_codeReaders.size(); i++) {
+        if (m_codeReaders[i] == CodeReaderFree) {
+            m_codeReaders[i] = *index;
+            return (int) i;
+        }
+    }
+    m_codeReaders.push_back(*index);
+    return (int) m_codeReaders.size() - 1;
+}
+
+LX_API void Memory::RemoveCodeReader( int reader )
+{
+    SyncObjectLock lock(*this);
+    Assert(reader >= 0 && reader < (int) m_codeReaders.size());
+    m_codeReaders[reader] = CodeReaderFree;
+    TrimCodeWrites();
+}
+
+LX_API void Memory::AckCodeWrites( int reader, u32 index )
+{
+    SyncObjectLock lock(*this);
+    Assert(reader >= 0 && reader < (int) m_codeReaders.size());
+    Assert(index >= m_codeReaders[reader] && index <= m_codeWriteCount);
+    m_codeReaders[reader] = index;
+    TrimCodeWrites();
+}
+
+void Memory::LogCodeWrite( u32 page )
+{
+    SyncObjectLock lock(*this);
+    m_codeWrites.push_back(page);
+    m_codeWriteCount = m_codeWriteBase + m_codeWrites.size();
+}
+
+void Memory::TrimCodeWrites()
+{
+    u32 oldest = m_codeWriteCount;
+    for (uint i = 0; i < m_codeReaders.size(); i++) {
+        if (m_codeReaders[i] != CodeReaderFree)
+            oldest = min(oldest, m_codeReaders[i]);
+    }
+    if (oldest == m_codeWriteBase) return;
+    m_codeWrites.erase(m_codeWrites.begin(), m_codeWrites.begin() + (oldest - m_codeWriteBase));
+    m_codeWriteBase = oldest;
+}
+
 LX_API void Memory::Erase()
 {
     for (uint i = 0; i < m_sections.size(); i++)
@@ -14,6 +14,7 @@ class LX_API Memory : public MutexSyncObject {
     // Simulate x86 RAM
     // A naive implementation; may optimize this
     friend class Processor;
+    friend class Section;
 public:
     Memory();
     virtual ~Memory();
@@ -98,6 +99,11 @@ public:
     bool            Contains        (u32 address) const { return GetSection(address) != NULL; }
     bool            Overlaps        (u32 address, u32 size) const;
     INLINE pbyte    GetRawData      (u32 address) const;
+    /*
+     * Raw data of 'address' if its page is committed and allows the access;
+     * valid up to the end of that page
+     */
+    INLINE pbyte    GetAccessPtr    (u32 address, bool write) const;
     void            Erase           (void);
     void            Clear           (void);
 
@@ -116,16 +122,36 @@ public:
     std::vector<PageInfo>       GetSectionInfo(u32 address) const;
     SectionDesc     GetSectionDesc(u32 address) const;
     Section *       GetSection(u32 address) const { return m_sectionTable[PAGE_NUM(address)]; }
+
+    /*
+     * Self-modifying code tracking
+     * Pages instructions were decoded from are logged once they are written to,
+     * decommitted or freed; processors replay the log to drop stale decodings
+     * Every processor registers as a reader and acknowledges what it applied,
+     * entries all readers have passed are trimmed. Indices never restart
+     */
+    void            MarkCode        (u32 address);
+    u32             CodeWriteCount  (void) const { return m_codeWriteCount; }
+    u32             GetCodeWrite    (u32 index) const;
+    int             AddCodeReader   (u32 *index);
+    void            RemoveCodeReader(int reader);
+    void            AckCodeWrites   (int reader, u32 index);
 protected:
     void            InsertSection(Section *sec);
     void            RemoveSection(Section *sec);
     bool            IsHeap(Section *sec) const { return m_heaps.find(sec) != m_heaps.end(); }
     bool            IsStack(Section *sec) const { return m_stacks.find(sec) != m_stacks.end(); }
+    void            LogCodeWrite(u32 page);
+    void            TrimCodeWrites(void);
 private:
     Section *       m_sectionTable[LX_PAGE_COUNT];
     std::vector<Section *>   m_sections;
     std::set<Section *>  m_heaps;
     std::set<Section *>  m_stacks;
+    std::vector<u32>     m_codeWrites;      // entries from m_codeWriteBase on
+    u32                  m_codeWriteBase;
+    volatile u32         m_codeWriteCount;
+    std::vector<u32>     m_codeReaders;     // index each reader applied up to
 }; // class Memory
 
 INLINE uint Memory::GetPageState(uint addr) const 
@@ -208,6 +234,12 @@ INLINE pbyte Memory::GetRawData(u32 address) const
     return GetSection(address)->GetRawData(address); 
 }
 
+INLINE pbyte Memory::GetAccessPtr(u32 address, bool write) const
+{
+    Section *s = GetSection(address);
+    return s == NULL ? NULL : s->GetAccessPtr(address, write);
+}
+
 INLINE static u32 RoundUp(u32 size)
 {
     return PAGE_LOW(size) == 0 ? size : PAGE_HIGH(size) + LX_PAGE_SIZE;
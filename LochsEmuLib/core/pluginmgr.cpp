@@ -8,7 +8,9 @@ BEGIN_NAMESPACE_LOCHSEMU()
 
 PluginManager::PluginManager()
 {
-
+    m_numPlugins    = 0;
+    m_enablePlugins = false;
+    m_events        = 0;
 }
 
 PluginManager::~PluginManager()
@@ -75,6 +77,7 @@ LxResult PluginManager::LoadPlugins()
                 LxInfo("Plugin %s successfully loaded\n", path.c_str());
                 LxInfo("Plugin %s, %d\n", plugin.Info.Name, lochsemu.Handle);
                 m_plugins.push_back(plugin);
+                Subscribe(plugin);
             } else {
                 LxWarning("Plugin %s not initialized\n", path.c_str());
             }
@@ -119,6 +122,29 @@ void PluginManager::LoadAPIAddrs( LoadedPluginInfo *plugin )
         GetProcAddress(plugin->Handle, "LochsEmu_Thread_Exit");
 }
 
+void PluginManager::Subscribe( const LoadedPluginInfo &plugin )
+{
+#define SUBSCRIBE(event)    if (plugin.event) m_subscribers.event.push_back(plugin.event)
+    SUBSCRIBE(Cleanup);
+    SUBSCRIBE(ProcessorPreExecute);
+    SUBSCRIBE(ProcessorPostExecute);
+    SUBSCRIBE(ProcessorMemRead);
+    SUBSCRIBE(ProcessorMemWrite);
+    SUBSCRIBE(ProcessPreRun);
+    SUBSCRIBE(ProcessPostRun);
+    SUBSCRIBE(ProcessPreLoad);
+    SUBSCRIBE(ProcessPostLoad);
+    SUBSCRIBE(WinapiPreCall);
+    SUBSCRIBE(WinapiPostCall);
+    SUBSCRIBE(ThreadCreate);
+    SUBSCRIBE(ThreadExit);
+#undef SUBSCRIBE
+
+    if (plugin.ProcessorPreExecute)     m_events |= LX_EVENT_PRE_EXECUTE;
+    if (plugin.ProcessorPostExecute)    m_events |= LX_EVENT_POST_EXECUTE;
+    if (plugin.ProcessorMemRead)        m_events |= LX_EVENT_MEM_READ;
+    if (plugin.ProcessorMemWrite)       m_events |= LX_EVENT_MEM_WRITE;
+}
 
 bool PluginManager::CheckPlugin( const LoadedPluginInfo &plugin )
 {
@@ -139,130 +165,104 @@ bool PluginManager::CheckPlugin( const LoadedPluginInfo &plugin )
 
 LxResult PluginManager::OnProcessorPreExecute( Processor *cpu, const Instruction *inst )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessorPreExecute)
-            plugin.ProcessorPreExecute(cpu, inst);
+    for (auto callback : m_subscribers.ProcessorPreExecute) {
+        callback(cpu, inst);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnProcessorPostExecute( Processor *cpu, const Instruction *inst )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessorPostExecute)
-            plugin.ProcessorPostExecute(cpu, inst);
+    for (auto callback : m_subscribers.ProcessorPostExecute) {
+        callback(cpu, inst);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnProcessorMemRead( const Processor *cpu, u32 addr, u32 nBytes, cpbyte data )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessorMemRead)
-            plugin.ProcessorMemRead(cpu, addr, nBytes, data);
+    for (auto callback : m_subscribers.ProcessorMemRead) {
+        callback(cpu, addr, nBytes, data);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnProcessorMemWrite( const Processor *cpu, u32 addr, u32 nBytes, cpbyte data)
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessorMemWrite)
-            plugin.ProcessorMemWrite(cpu, addr, nBytes, data);
+    for (auto callback : m_subscribers.ProcessorMemWrite) {
+        callback(cpu, addr, nBytes, data);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnExit( void )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.Cleanup)
-            plugin.Cleanup();
+    for (auto callback : m_subscribers.Cleanup) {
+        callback();
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnProcessPreRun( const Process *proc, Processor *cpu )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessPreRun)
-            plugin.ProcessPreRun(proc, cpu);
+    for (auto callback : m_subscribers.ProcessPreRun) {
+        callback(proc, cpu);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnProcessPostRun( const Process *proc )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessPostRun)
-            plugin.ProcessPostRun(proc);
+    for (auto callback : m_subscribers.ProcessPostRun) {
+        callback(proc);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnProcessPreLoad( PeLoader *loader )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessPreLoad)
-            plugin.ProcessPreLoad(loader);
+    for (auto callback : m_subscribers.ProcessPreLoad) {
+        callback(loader);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnProcessPostLoad( PeLoader *loader )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ProcessPostLoad)
-            plugin.ProcessPostLoad(loader);
+    for (auto callback : m_subscribers.ProcessPostLoad) {
+        callback(loader);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnWinapiPreCall( Processor *cpu, uint apiIndex )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.WinapiPreCall)
-            plugin.WinapiPreCall(cpu, apiIndex);
+    for (auto callback : m_subscribers.WinapiPreCall) {
+        callback(cpu, apiIndex);
     }
     RET_SUCCESS();
 }
 
 LxResult PluginManager::OnWinapiPostCall( Processor *cpu, uint apiIndex )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.WinapiPostCall)
-            plugin.WinapiPostCall(cpu, apiIndex);
+    for (auto callback : m_subscribers.WinapiPostCall) {
+        callback(cpu, apiIndex);
     }
     RET_SUCCESS();
 }
 
 LochsEmu::LxResult PluginManager::OnThreadCreate( Thread *thrd )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ThreadCreate)
-            plugin.ThreadCreate(thrd);
+    for (auto callback : m_subscribers.ThreadCreate) {
+        callback(thrd);
     }
     RET_SUCCESS();
 }
 
 LochsEmu::LxResult PluginManager::OnThreadExit( Thread *thrd )
 {
-    if (!m_enablePlugins) RET_SUCCESS();
-    for (auto plugin : m_plugins) {
-        if (plugin.ThreadExit)
-            plugin.ThreadExit(thrd);
+    for (auto callback : m_subscribers.ThreadExit) {
+        callback(thrd);
     }
     RET_SUCCESS();
 }
@@ -48,6 +48,33 @@ struct LoadedPluginInfo {
     }
 };
 
+/*
+ * Callbacks of the loaded plugins grouped per event, in loading order
+ */
+struct PluginSubscribers {
+    std::vector<LochsEmu_Plugin_Cleanup>        Cleanup;
+    std::vector<LochsEmu_Processor_PreExecute>  ProcessorPreExecute;
+    std::vector<LochsEmu_Processor_PostExecute> ProcessorPostExecute;
+    std::vector<LochsEmu_Processor_MemRead>     ProcessorMemRead;
+    std::vector<LochsEmu_Processor_MemWrite>    ProcessorMemWrite;
+    std::vector<LochsEmu_Process_PreRun>        ProcessPreRun;
+    std::vector<LochsEmu_Process_PostRun>       ProcessPostRun;
+    std::vector<LochsEmu_Process_PreLoad>       ProcessPreLoad;
+    std::vector<LochsEmu_Process_PostLoad>      ProcessPostLoad;
+    std::vector<LochsEmu_Winapi_PreCall>        WinapiPreCall;
+    std::vector<LochsEmu_Winapi_PostCall>       WinapiPostCall;
+    std::vector<LochsEmu_Thread_Create>         ThreadCreate;
+    std::vector<LochsEmu_Thread_Exit>           ThreadExit;
+};
+
+// Per-instruction events, see PluginManager::Subscribed()
+#define LX_EVENT_PRE_EXECUTE    0x1
+#define LX_EVENT_POST_EXECUTE   0x2
+#define LX_EVENT_MEM_READ       0x4
+#define LX_EVENT_MEM_WRITE      0x8
+#define LX_EVENT_ACCESS         (LX_EVENT_PRE_EXECUTE | LX_EVENT_POST_EXECUTE | \
+                                 LX_EVENT_MEM_READ | LX_EVENT_MEM_WRITE)
+
 class PluginManager {
 public:
     PluginManager();
@@ -68,10 +95,23 @@ public:
     LxResult OnThreadCreate         (Thread *thrd);
     LxResult OnThreadExit           (Thread *thrd);
 
+    /*
+     * True if some plugin listens to any of the LX_EVENT_* 'events'
+     * Hot paths check this before dispatching
+     */
+    bool            Subscribed(u32 events) const { return (m_events & events) != 0; }
+
+    /*
+     * True if some plugin observes single instructions or memory accesses,
+     * in which case bulk execution paths must not be taken
+     */
+    bool            HasAccessHooks() const { return Subscribed(LX_EVENT_ACCESS); }
+
 private:
     bool            FindPluginDirectory();
     LxResult        LoadPlugins();
     void            LoadAPIAddrs(LoadedPluginInfo *plugin);
+    void            Subscribe(const LoadedPluginInfo &plugin);
     bool            CheckPlugin(const LoadedPluginInfo &plugin);
 
 private:
@@ -82,6 +122,8 @@ private:
     PluginTable         m_plugins;
     uint                m_numPlugins;
     bool                m_enablePlugins;
+    PluginSubscribers   m_subscribers;
+    u32                 m_events;       // LX_EVENT_*
 
 };
 
@@ -8,6 +8,7 @@
 #include "coprocessor.h"
 #include "winapi.h"
 #include "process.h"
+#include "blockcache.h"
 
 BEGIN_NAMESPACE_LOCHSEMU()
 
@@ -15,12 +16,23 @@ Processor::Processor(int id, Thread *thread) : IntID(id)
 {
     Assert(thread);
     m_thread = thread;
+    m_blockCache = new BlockCache();
+    m_lastBlock = NULL;
+    m_codeWriteIndex = 0;
+    m_codeReader = -1;
+    m_stepDepth = 0;
+    ZeroMemory(&m_lazy, sizeof(m_lazy));
 }
 
 Processor::~Processor()
 {
+    if (Mem && m_codeReader >= 0) {
+        Mem->RemoveCodeReader(m_codeReader);
+    }
     Mem = NULL;
     m_emulator = NULL;
+    m_lastBlock = NULL;
+    SAFE_DELETE(m_blockCache);
 }
 
 
@@ -31,6 +43,9 @@ LxResult Processor::Initialize()
     m_emulator = m_process->Emu();
     m_plugins = m_thread->Plugins();
     Reset();
+    if (m_codeReader < 0) {
+        m_codeReader = Mem->AddCodeReader(&m_codeWriteIndex);
+    }
 
     ESP = m_thread->GetStack()->Top();
     V( m_fpu.Initialize() );
@@ -43,6 +58,7 @@ void Processor::Reset()
 {
     EAX = ECX = EDX = EBX = ESP = EBP = ESI = EDI = ZERO = 0;
     CS = DS = SS = ES = FS = GS = 0;
+    m_lazy.Op = LX_LAZY_NONE;
     CF = PF = AF = ZF = SF = TF = IF = DF = OF = IOPL = NT = RF
         = VM = AC = VIF = VIP = ID = 0;
     EIP = 0;
@@ -58,44 +74,172 @@ void Processor::Reset()
     m_terminated = true;
     ZeroMemory(m_callbackTable, sizeof(u32) * LX_CALLBACKS);
     m_inst = NULL;
+    m_lastBlock = NULL;
     m_fpu.Reset();
     m_currSection = NULL;
     m_lastEip = 0;
+    FlushTlb();
     ClearExecFlags();
 }
 
+void Processor::FlushTlb() const
+{
+    for (uint i = 0; i < LX_TLB_ENTRIES; i++) {
+        m_tlb[i].Page = LX_TLB_INVALID;
+        m_tlb[i].Perm = 0;
+        m_tlb[i].Host = NULL;
+    }
+    m_tlbVersion = Section::LayoutVersion();
+}
+
+pbyte Processor::TlbFill( u32 address, u32 perm ) const
+{
+    Section *sec = Mem->GetSection(address);
+    if (sec == NULL) return NULL;
+
+    const u32 page = PAGE_HIGH(address);
+    u32 allowed = 0;
+    pbyte host = sec->GetAccessPtr(page, false);
+    if (host) allowed |= LX_TLB_READ;
+    if (sec->GetAccessPtr(page, true)) allowed |= LX_TLB_WRITE;
+    if (!(allowed & perm)) return NULL;
+
+    if (NULL == host) host = sec->GetRawData(page);
+    TlbEntry &e = m_tlb[PAGE_NUM(address) & (LX_TLB_ENTRIES - 1)];
+    e.Page  = PAGE_NUM(address);
+    e.Perm  = allowed;
+    e.Host  = host;
+    return host + PAGE_LOW(address);
+}
+
 LxResult Processor::Step()
 {
-    // look up the inst decode cache
-    m_inst = m_instCache.Lookup(EIP);
+    if (m_codeWriteIndex != Mem->CodeWriteCount()) {
+        SyncCodeWrites();
+    }
 
-    if (NULL == m_inst) {
-        // fetch at current EIP
-        pbyte codePtr = GetCodePtr();
-        m_inst = new Instruction();
-        LxDecode(codePtr, m_inst, EIP);
-        m_instCache.Insert(EIP, m_inst);
+    /*
+     * Callbacks re-enter Step from inside an instruction, so only the
+     * outermost call knows that no block or instruction is still in use
+     */
+    if (m_stepDepth == 0 && m_blockCache->HasRetired()) {
+        m_blockCache->ReleaseRetired();
+        m_inst = NULL;
+    }
+
+    m_stepDepth++;
+    LxResult lr = ExecuteBlock();
+    m_stepDepth--;
+    return lr;
+}
+
+LxResult Processor::ExecuteBlock()
+{
+    // follow the chain from the previous block before looking up the cache
+    const u32 epoch = m_blockCache->Epoch();
+    BasicBlock *block = m_lastBlock ? m_lastBlock->Successor(EIP, epoch) : NULL;
+    if (NULL == block) {
+        block = m_blockCache->LookupBlock(EIP);
+        if (NULL == block) {
+            block = TranslateBlock(EIP);
+        }
+        if (m_lastBlock) {
+            m_lastBlock->Chain(block, epoch);
+        }
     }
 
     m_currSection = Mem->GetSection(EIP);
 
-    /*
-     * let plugins do their work
-     */
-    m_plugins->OnProcessorPreExecute(this, m_inst);
+    // flags that should survive through the whole block
+    const u32 keepFlags = m_execFlags & LX_EXEC_CALLBACK;
+    const bool preExecute   = m_plugins->Subscribed(LX_EVENT_PRE_EXECUTE);
+    const bool postExecute  = m_plugins->Subscribed(LX_EVENT_POST_EXECUTE);
 
-    V( Execute(m_inst) );
+    for (uint i = 0; i < block->Count; i++) {
+        const Instruction *inst = block->Insts[i];
+        m_inst = inst;
 
-    m_plugins->OnProcessorPostExecute(this, m_inst);
+        /*
+         * let plugins do their work
+         */
+        if (preExecute) m_plugins->OnProcessorPreExecute(this, inst);
 
-    Assert(EIP == TERMINATE_EIP || Mem->Contains(EIP));
+        V( Execute(inst, block->Handlers[i]) );
 
-    // clear execution flag
-    ClearExecFlags();
+        if (postExecute) m_plugins->OnProcessorPostExecute(this, inst);
 
+        Assert(EIP == TERMINATE_EIP || Mem->Contains(EIP));
+
+        // clear execution flag
+        ClearExecFlags();
+
+        // leave the block if anything other than falling through happened
+        if (m_terminated || EIP != (u32) inst->Main.VirtualAddr + inst->Length)
+            break;
+        // the rest of the block may have just been overwritten,
+        // or already been dropped by a nested Step
+        if (m_codeWriteIndex != Mem->CodeWriteCount() || m_blockCache->Epoch() != epoch)
+            break;
+        SetExecFlag(keepFlags);
+    }
+
+    // a dropped block must not be chained from, it is freed before the next block runs
+    m_lastBlock = m_blockCache->Epoch() == epoch ? block : NULL;
     RET_SUCCESS();
 }
 
+Instruction * Processor::FetchInst( u32 eip )
+{
+    // look up the inst decode cache
+    Instruction *inst = m_blockCache->LookupInst(eip);
+
+    if (NULL == inst) {
+        // fetch at eip
+        pbyte codePtr = GetCodePtr(eip);
+        inst = new Instruction();
+        LxDecode(codePtr, inst, eip);
+        m_blockCache->InsertInst(eip, inst);
+
+        // watch for writes to the bytes just decoded
+        Mem->MarkCode(eip);
+        if (inst->Length > 0 && PAGE_NUM(eip + inst->Length - 1) != PAGE_NUM(eip)) {
+            Mem->MarkCode(eip + inst->Length - 1);
+        }
+    }
+    return inst;
+}
+
+void Processor::SyncCodeWrites()
+{
+    const u32 count = Mem->CodeWriteCount();
+    for (; m_codeWriteIndex < count; m_codeWriteIndex++) {
+        m_blockCache->InvalidatePage(Mem->GetCodeWrite(m_codeWriteIndex));
+    }
+    Mem->AckCodeWrites(m_codeReader, m_codeWriteIndex);
+    m_lastBlock = NULL;
+}
+
+BasicBlock * Processor::TranslateBlock( u32 eip )
+{
+    BasicBlock *block = new BasicBlock(eip);
+    u32 addr = eip;
+    while (block->Count < LX_BLOCK_MAX_INSTS) {
+        const Instruction *inst = FetchInst(addr);
+        block->Insts[block->Count]      = inst;
+        block->Handlers[block->Count]   = GetHandler(inst);
+        block->Count++;
+        addr += inst->Length;
+
+        // stop at control transfers, unsupported instructions and page boundaries
+        if (inst->Is(LX_INST_BRANCH)) break;
+        if (block->Handlers[block->Count-1] == NULL) break;
+        if (PAGE_HIGH(addr) != PAGE_HIGH(eip) || !Mem->Contains(addr)) break;
+    }
+    block->End = addr;
+    m_blockCache->InsertBlock(block);
+    return block;
+}
+
 LxResult Processor::Run(u32 entry)
 {
     EIP = entry; 
@@ -144,23 +288,32 @@ LxResult Processor::RunConditional( u32 entry )
 
 
 
+Processor::InstHandler Processor::GetHandler( const Instruction *inst )
+{
+    const u32 opcode = inst->Main.Inst.Opcode;
+    if (INST_ONEBYTE(opcode)) {
+        return InstTableOneByte[opcode];
+    } else if (INST_TWOBYTE(opcode)) {
+        return InstTableTwoBytes[opcode & 0xff];
+    } else if (opcode == 0x0f3840) {
+        return &Processor::Pmulld_660F3840;
+    } else if (opcode == 0x0f3a63) {
+        return &Processor::Pcmpistri_660F3A63;
+    }
+    return NULL;
+}
+
 LxResult Processor::Execute( const Instruction *inst )
+{
+    return Execute(inst, GetHandler(inst));
+}
+
+LxResult Processor::Execute( const Instruction *inst, InstHandler h )
 {
     m_lastEip = EIP;
     EIP += inst->Length;
 
-    InstHandler h;
-
-    if (INST_ONEBYTE(inst->Main.Inst.Opcode)) {
-        h = InstTableOneByte[inst->Main.Inst.Opcode];
-    } else if (INST_TWOBYTE(inst->Main.Inst.Opcode)) {
-        h = InstTableTwoBytes[inst->Main.Inst.Opcode & 0xff];
-    } else if (inst->Main.Inst.Opcode == 0x0f3840) {
-        h = &Processor::Pmulld_660F3840;
-    } else if (inst->Main.Inst.Opcode == 0x0f3a63) {
-        h = &Processor::Pcmpistri_660F3A63;
-    }
-    else {
+    if (NULL == h) {
         LxFatal("Unsupported instruction: %s\n", inst->Main.CompleteInstr);
     }
 
@@ -180,8 +333,10 @@ LxResult Processor::Execute( const Instruction *inst )
     const u32 opcode = inst->Main.Inst.Opcode;
     // Thanks to shitty MOVQ_F30F7E
     if (inst->Main.Prefix.RepPrefix && !isRet && opcode != 0x0f7e && opcode != 0x0f6f) {
-        (this->*h)(inst);
-        ECX--;
+        if (!RepStringBulk(inst, false)) {
+            (this->*h)(inst);
+            ECX--;
+        }
         bool isRepe = opcode == 0xa6 || opcode == 0xa7 || opcode == 0xae || opcode == 0xaf;
         if ((ECX != 0) && !(isRepe && ZF == 0)) {
             EIP -= inst->Length;    // continue running
@@ -190,8 +345,10 @@ LxResult Processor::Execute( const Instruction *inst )
     } else if (inst->Main.Prefix.RepnePrefix 
         && opcode != 0x0f10 && opcode != 0x0f11 && opcode != 0x0f58) // MOVSD, ADDSD
     {
-        (this->*h)(inst);
-        ECX--;
+        if (!RepStringBulk(inst, true)) {
+            (this->*h)(inst);
+            ECX--;
+        }
         if (ECX != 0 && ZF != 1) {
             EIP -= inst->Length;
         }
@@ -279,8 +436,10 @@ INLINE u8 Processor::MemRead8( u32 address, RegSeg seg ) const
 {
     u8 val = INIT_8;
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Read8(address, &val); 
-    m_plugins->OnProcessorMemRead(this, address, 1, (cpbyte) &val);
+    pbyte p = Translate(address, 1, LX_TLB_READ);
+    if (p) val = *((u8 *) p); else Mem->Read8(address, &val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_READ))
+        m_plugins->OnProcessorMemRead(this, address, 1, (cpbyte) &val);
     return val;
 }
 
@@ -288,8 +447,10 @@ INLINE u16 Processor::MemRead16( u32 address, RegSeg seg ) const
 {
     u16 val = INIT_16;
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Read16(address, &val);
-    m_plugins->OnProcessorMemRead(this, address, 2, (cpbyte) &val);
+    pbyte p = Translate(address, 2, LX_TLB_READ);
+    if (p) val = *((u16 *) p); else Mem->Read16(address, &val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_READ))
+        m_plugins->OnProcessorMemRead(this, address, 2, (cpbyte) &val);
     return val;
 }
 
@@ -297,8 +458,10 @@ INLINE u32 Processor::MemRead32( u32 address, RegSeg seg ) const
 {
     u32 val = INIT_32;
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Read32(address, &val);
-    m_plugins->OnProcessorMemRead(this, address, 4, (cpbyte) &val);
+    pbyte p = Translate(address, 4, LX_TLB_READ);
+    if (p) val = *((u32 *) p); else Mem->Read32(address, &val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_READ))
+        m_plugins->OnProcessorMemRead(this, address, 4, (cpbyte) &val);
     return val;
 }
 
@@ -306,8 +469,10 @@ INLINE u64 Processor::MemRead64( u32 address, RegSeg seg ) const
 {
     u64 val = INIT_64;
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Read64(address, &val);
-    m_plugins->OnProcessorMemRead(this, address, 8, (cpbyte) &val);
+    pbyte p = Translate(address, 8, LX_TLB_READ);
+    if (p) val = *((u64 *) p); else Mem->Read64(address, &val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_READ))
+        m_plugins->OnProcessorMemRead(this, address, 8, (cpbyte) &val);
     return val;
 }
 
@@ -315,50 +480,83 @@ INLINE u128 Processor::MemRead128( u32 address, RegSeg seg ) const
 {
     u128 val;
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Read128(address, &val);
-    m_plugins->OnProcessorMemRead(this, address, 16, (cpbyte) &val);
+    pbyte p = Translate(address, 16, LX_TLB_READ);
+    if (p) memcpy(&val, p, sizeof(u128)); else Mem->Read128(address, &val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_READ))
+        m_plugins->OnProcessorMemRead(this, address, 16, (cpbyte) &val);
     return val;
 }
 
 INLINE void Processor::MemWrite8( u32 address, u8 val, RegSeg seg )
 {
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Write8(address, val);
-    m_plugins->OnProcessorMemWrite(this, address, 1, (cpbyte) &val);
+    pbyte p = Translate(address, 1, LX_TLB_WRITE);
+    if (p) *((u8 *) p) = val; else Mem->Write8(address, val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_WRITE))
+        m_plugins->OnProcessorMemWrite(this, address, 1, (cpbyte) &val);
 }
 
 INLINE void Processor::MemWrite16( u32 address, u16 val, RegSeg seg )
 {
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Write16(address, val);
-    m_plugins->OnProcessorMemWrite(this, address, 2, (cpbyte) &val);
+    pbyte p = Translate(address, 2, LX_TLB_WRITE);
+    if (p) *((u16 *) p) = val; else Mem->Write16(address, val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_WRITE))
+        m_plugins->OnProcessorMemWrite(this, address, 2, (cpbyte) &val);
 }
 
 INLINE void Processor::MemWrite32( u32 address, u32 val, RegSeg seg )
 {
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Write32(address, val);
-    m_plugins->OnProcessorMemWrite(this, address, 4, (cpbyte) &val);
+    pbyte p = Translate(address, 4, LX_TLB_WRITE);
+    if (p) *((u32 *) p) = val; else Mem->Write32(address, val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_WRITE))
+        m_plugins->OnProcessorMemWrite(this, address, 4, (cpbyte) &val);
 }
 
 INLINE void Processor::MemWrite64( u32 address, u64 val, RegSeg seg )
 {
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Write64(address, val);
-    m_plugins->OnProcessorMemWrite(this, address, 8, (cpbyte) &val);
+    pbyte p = Translate(address, 8, LX_TLB_WRITE);
+    if (p) *((u64 *) p) = val; else Mem->Write64(address, val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_WRITE))
+        m_plugins->OnProcessorMemWrite(this, address, 8, (cpbyte) &val);
 }
 
 INLINE void Processor::MemWrite128( u32 address, const u128 &val, RegSeg seg )
 {
     if (seg == LX_REG_FS) { address = GetFSOffset(address); }
-    Mem->Write128(address, val);
-    m_plugins->OnProcessorMemWrite(this, address, 16, (cpbyte) &val);
+    pbyte p = Translate(address, 16, LX_TLB_WRITE);
+    if (p) memcpy(p, &val, sizeof(u128)); else Mem->Write128(address, val);
+    if (m_plugins->Subscribed(LX_EVENT_MEM_WRITE))
+        m_plugins->OnProcessorMemWrite(this, address, 16, (cpbyte) &val);
 }
 
 u32 Processor::GetFSOffset(u32 addr) const {
     return m_thread->GetTEBAddress() + addr;
 }
 
+void Processor::EvaluateFlags() const
+{
+    const u32 mask = m_lazy.Width == 32 ? 0xffffffff : (1 << m_lazy.Width) - 1;
+    const u32 r = m_lazy.Result & mask;
+    const u32 op = m_lazy.Op;
+
+    m_flagZF = (r == 0);
+    m_flagSF = (r >> (m_lazy.Width - 1)) & 1;
+    m_flagPF = PARITY8(r);
+
+    if (op == LX_LAZY_ARITH) {
+        // result doesn't fit in the destination
+        i64 sr = (i64) (i32) (r << (32 - m_lazy.Width)) >> (32 - m_lazy.Width);
+        m_flagCF = (m_lazy.UResult != (u64) r);
+        m_flagOF = (m_lazy.IResult != sr);
+    } else if (op == LX_LAZY_LOGIC) {
+        m_flagCF = m_flagOF = 0;
+    }
+    m_lazy.Op = LX_LAZY_NONE;
+}
+
 u32 Processor::GetEflags() const
 {
     u32 r = 0;
@@ -473,6 +671,19 @@ uint Processor::GetModule( u32 eip ) const
 
 u8 Processor::ReadOperand8( const Instruction *inst, const ARGTYPE &oper, u32 *offset ) const
 {
+    const InstOperand *op = inst->Operand(oper);
+    if (op) {
+        if (op->Kind == LX_OPERAND_GPR && op->Reg8 != LX_OPERAND_NOREG) {
+            return *GP_Regs8[op->Reg8];
+        } else if (op->Kind == LX_OPERAND_MEM) {
+            RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
+            u32 o = Offset32(op);
+            if (offset) *offset = o;
+            return MemRead8(o, seg);
+        } else if (op->Kind == LX_OPERAND_IMM) {
+            return (u8) inst->Main.Inst.Immediat;
+        }
+    }
     if (IsRegArg(oper)) {
         return GP_Reg8(REG_NUM(oper.ArgType), oper.ArgPosition);
     } else if (IsMemoryArg(oper)) {
@@ -490,6 +701,19 @@ u8 Processor::ReadOperand8( const Instruction *inst, const ARGTYPE &oper, u32 *o
 
 u16 Processor::ReadOperand16( const Instruction *inst, const ARGTYPE &oper, u32 *offset ) const
 {
+    const InstOperand *op = inst->Operand(oper);
+    if (op) {
+        if (op->Kind == LX_OPERAND_GPR) {
+            return GP_Regs[op->Reg].X16;
+        } else if (op->Kind == LX_OPERAND_MEM) {
+            RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
+            u32 o = Offset32(op);
+            if (offset) *offset = o;
+            return MemRead16(o, seg);
+        } else if (op->Kind == LX_OPERAND_IMM) {
+            return (u16) inst->Main.Inst.Immediat;
+        }
+    }
     if (IsRegArg(oper)) {
         return GP_Reg16(REG_NUM(oper.ArgType));
     } else if (IsMemoryArg(oper)) {
@@ -507,6 +731,19 @@ u16 Processor::ReadOperand16( const Instruction *inst, const ARGTYPE &oper, u32
 
 u32 Processor::ReadOperand32( const Instruction *inst, const ARGTYPE &oper, u32 *offset ) const
 {
+    const InstOperand *op = inst->Operand(oper);
+    if (op) {
+        if (op->Kind == LX_OPERAND_GPR) {
+            return GP_Regs[op->Reg].X32;
+        } else if (op->Kind == LX_OPERAND_MEM) {
+            RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
+            u32 o = Offset32(op);
+            if (offset) *offset = o;
+            return MemRead32(o, seg);
+        } else if (op->Kind == LX_OPERAND_IMM) {
+            return (u32) inst->Main.Inst.Immediat;
+        }
+    }
     if (IsRegArg(oper)) {
         return GP_Reg32(REG_NUM(oper.ArgType));
     } else if (IsMemoryArg(oper)) {
@@ -558,6 +795,17 @@ u128 Processor::ReadOperand128(const Instruction *inst, const ARGTYPE &oper, u32
 
 void Processor::WriteOperand8( const Instruction *inst, const ARGTYPE &oper, u32 offset, u8 val )
 {
+    const InstOperand *op = inst->Operand(oper);
+    if (op) {
+        if (op->Kind == LX_OPERAND_GPR && op->Reg8 != LX_OPERAND_NOREG) {
+            *GP_Regs8[op->Reg8] = val;
+            return;
+        } else if (op->Kind == LX_OPERAND_MEM) {
+            RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
+            MemWrite8(offset, val, seg);
+            return;
+        }
+    }
     if (IsMemoryArg(oper)) {
         RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
         MemWrite8(offset, val, seg);
@@ -572,6 +820,17 @@ void Processor::WriteOperand8( const Instruction *inst, const ARGTYPE &oper, u32
 
 void Processor::WriteOperand16( const Instruction *inst, const ARGTYPE &oper, u32 offset, u16 val )
 {
+    const InstOperand *op = inst->Operand(oper);
+    if (op) {
+        if (op->Kind == LX_OPERAND_GPR) {
+            GP_Regs[op->Reg].X16 = val;
+            return;
+        } else if (op->Kind == LX_OPERAND_MEM) {
+            RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
+            MemWrite16(offset, val, seg);
+            return;
+        }
+    }
     if (IsMemoryArg(oper)) {
         RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
         MemWrite16(offset, val, seg);
@@ -586,6 +845,17 @@ void Processor::WriteOperand16( const Instruction *inst, const ARGTYPE &oper, u3
 
 void Processor::WriteOperand32( const Instruction *inst, const ARGTYPE &oper, u32 offset, u32 val )
 {
+    const InstOperand *op = inst->Operand(oper);
+    if (op) {
+        if (op->Kind == LX_OPERAND_GPR) {
+            GP_Regs[op->Reg].X32 = val;
+            return;
+        } else if (op->Kind == LX_OPERAND_MEM) {
+            RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
+            MemWrite32(offset, val, seg);
+            return;
+        }
+    }
     if (IsMemoryArg(oper)) {
         RegSeg seg = inst->Main.Prefix.FSPrefix ? LX_REG_FS : LX_REG_DS;
         MemWrite32(offset, val, seg);
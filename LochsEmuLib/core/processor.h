@@ -10,7 +10,6 @@
 #include "win32.h"
 #include "debug.h"
 #include "pluginmgr.h"
-#include "hashtable.h"
 #include "simd.h"
 #include "exception.h"
 #include "coprocessor.h"
@@ -109,6 +108,9 @@ enum RegXMM {
 #define MSB32(x)    ((((u32) x) >> 31) & 1)
 #define LSB(x)      ((x) & 0x1)
 
+// Even parity of the low byte, as reported by PF
+#define PARITY8(x)  ((0x9669 >> ((((u8) (x)) ^ (((u8) (x)) >> 4)) & 0xf)) & 1)
+
 // Sign-Extend
 #define SIGN_EXTEND(from_bits, to_bits, value)  ((u##to_bits)(i##to_bits)(i##from_bits) (value))
 
@@ -119,6 +121,46 @@ enum RegXMM {
 #define TERMINATE_EIP        0x0
 
 
+// Status flag stored in m_flag##name, evaluated from m_lazy on first access
+#define LX_LAZY_FLAG(name)  \
+    __declspec(property(get = GetFlag##name, put = PutFlag##name)) u32 name; \
+    u32     GetFlag##name   (void) const    { SyncFlags(); return m_flag##name; } \
+    u32     PutFlag##name   (u32 val)       { SyncFlags(); return m_flag##name = val; }
+
+// Kinds of pending flag evaluations
+#define LX_LAZY_NONE        0
+#define LX_LAZY_ARITH       1   // CF, OF, ZF, PF, SF
+#define LX_LAZY_LOGIC       2   // ZF, PF, SF; CF = OF = 0
+#define LX_LAZY_SHIFT       3   // ZF, PF, SF
+
+/*
+ * The last flag-setting operation, recorded instead of computing its flags
+ * Result is the truncated result, UResult and IResult its unsigned and signed
+ * results computed in a wider type
+ */
+struct LazyFlags {
+    u32     Op;
+    u32     Width;
+    u32     Result;
+    u64     UResult;
+    i64     IResult;
+};
+
+// Software TLB
+#define LX_TLB_ENTRIES          256     // direct-mapped; must be a power of 2
+#define LX_TLB_INVALID          0xffffffff
+#define LX_TLB_READ             0x1
+#define LX_TLB_WRITE            0x2
+
+/*
+ * Cached translation of a guest page to host memory
+ */
+struct TlbEntry {
+    u32     Page;       // guest page number, LX_TLB_INVALID if unused
+    u32     Perm;       // LX_TLB_READ | LX_TLB_WRITE
+    pbyte   Host;       // host address of the guest page
+};
+
 // Execution flags
 #define LX_EXEC_WINAPI_CALL     0x1
 #define LX_EXEC_WINAPI_JMP      0x2
@@ -131,6 +173,9 @@ enum RegXMM {
 
 class LX_API Processor {
     // Simulation for x86 CPU
+public:
+    typedef void    (Processor::*InstHandler)(const Instruction *inst);
+
 public:
     Processor(int intid, Thread *thread);
     virtual ~Processor();
@@ -175,15 +220,16 @@ public:
     };
 
     // EFLAGS
-    u32 CF;     //  0(Status): Carry Flag
-    u32 PF;     //  2(Status): Parity Flag
+    // CF, PF, ZF, SF and OF are evaluated lazily; see LazyFlags
+    LX_LAZY_FLAG(CF);   //  0(Status): Carry Flag
+    LX_LAZY_FLAG(PF);   //  2(Status): Parity Flag
     u32 AF;     //  4(Status): Auxiliary Carry Flag
-    u32 ZF;     //  6(Status): Zero Flag
-    u32 SF;     //  7(Status): Sign Flag
+    LX_LAZY_FLAG(ZF);   //  6(Status): Zero Flag
+    LX_LAZY_FLAG(SF);   //  7(Status): Sign Flag
     u32 TF;     //  8(System): Trap Flag
     u32 IF;     //  9(System): Interrupt Enable Flag
     u32 DF;     // 10(Control): Direction Flag
-    u32 OF;     // 11(Status): Overflow Flag
+    LX_LAZY_FLAG(OF);   // 11(Status): Overflow Flag
     u32 IOPL;   // 12,13(System): I/O Privilege Level
     u32 NT;     // 14(System): Nested Task
     u32 RF;     // 16(System): Resume Flag
@@ -229,12 +275,18 @@ public:
     LxResult        RunConditional      (u32 entry);
     LxResult        Step                (void);
     LxResult        Execute             (const Instruction *inst);
+    LxResult        Execute             (const Instruction *inst, InstHandler h);
     void            Reset               (void);
     void            Terminate           (uint nCode);
     void            PushContext         (void);
     void            PopContext          (void);
     u32             GetEflags           (void) const;
     void            SetEflags           (u32 eflags);
+
+    /*
+     * Evaluate the pending lazy flags, if any
+     */
+    INLINE void     SyncFlags           (void) const { if (m_lazy.Op != LX_LAZY_NONE) EvaluateFlags(); }
     INLINE u32  &   Reg_32              (const ARGTYPE &oper);
     INLINE u16  &   Reg_16              (const ARGTYPE &oper);
     INLINE u8   &   Reg_8               (const ARGTYPE &oper);
@@ -267,6 +319,13 @@ public:
     INLINE void     MemWrite64          (u32 address, u64 val, RegSeg seg = LX_REG_DS);
     INLINE void     MemWrite128         (u32 address, const u128 &val, RegSeg seg = LX_REG_DS);
 
+    /*
+     * Host address of 'nBytes' guest bytes at 'address' through the TLB;
+     * NULL if the access crosses a page or is not allowed
+     */
+    INLINE pbyte    Translate           (u32 address, u32 nBytes, u32 perm) const;
+    void            FlushTlb            (void) const;
+
     /************************************************************************/
     /* Utilities                                                            */
     /************************************************************************/
@@ -291,6 +350,7 @@ public:
     void            Pop                 (u32 nBytes, pbyte content);
 
     INLINE u32      Offset32            (const ARGTYPE &oper) const;
+    INLINE u32      Offset32            (const InstOperand *op) const;
 
     // Set ZF according to result 'val'
     INLINE void     SetFlagZF8          (u8 val)    { ZF = (val == 0); }
@@ -330,6 +390,9 @@ public:
     INLINE void     SetFlagsShift16     (u16 val);
     INLINE void     SetFlagsShift32     (u32 val);
 
+    // Record a pending flag evaluation
+    INLINE void     SetFlagsLazy        (u32 op, u32 width, u32 val, const u64 &uv, const i64 &iv);
+
     // Read from mem/reg
     u8              ReadOperand8        (const Instruction *inst,   const ARGTYPE &oper,    u32 *offset) const;
     u16             ReadOperand16       (const Instruction *inst,   const ARGTYPE &oper,    u32 *offset) const;
@@ -369,8 +432,11 @@ public:
     bool            IsJumpTaken_Loop() const  { return ECX != 0; }
     bool            IsJumpTaken     (const Instruction *inst) const;
 
-public:
-        typedef void    (Processor::*InstHandler)(const Instruction *inst);
+    /*
+     * Find the handler of a decoded instruction; NULL if not supported
+     */
+    static InstHandler  GetHandler      (const Instruction *inst);
+
 private:
     static InstHandler      InstTableOneByte[];
     static InstHandler      InstTableTwoBytes[];
@@ -408,6 +474,15 @@ private:
     void        SetByte(const Instruction *inst, bool cond);
     void        JumpRel8(const Instruction *inst);
     void        JumpRel32(const Instruction *inst);
+    bool        RepStringBulk(const Instruction *inst, bool repne);
+
+    void            EvaluateFlags(void) const;
+
+    Instruction *   FetchInst(u32 eip);
+    LxResult        ExecuteBlock(void);
+    BasicBlock *    TranslateBlock(u32 eip);
+    pbyte           TlbFill(u32 address, u32 perm) const;
+    void            SyncCodeWrites(void);
 
 protected:
     Thread *        m_thread;
@@ -416,13 +491,29 @@ protected:
     Coprocessor     m_fpu;
     PluginManager * m_plugins;
     std::stack<u32> m_stack;
-    Instruction *   m_inst;
+    const Instruction * m_inst;
     bool            m_terminated;
     u32             m_callbackTable[LX_CALLBACKS];
-    Hashtable<Instruction>  m_instCache;
+    BlockCache *    m_blockCache;
+    BasicBlock *    m_lastBlock;
+    u32             m_codeWriteIndex;   // entries of Memory's code write log already applied
+    int             m_codeReader;       // reader slot in Memory's code write log
+    int             m_stepDepth;        // nesting of Step through callbacks
     u32             m_execFlags;    // Used to represent status after execution of each instruciton 
     Section *       m_currSection;
     u32             m_lastEip;
+
+    // Lazily evaluated status flags
+    mutable LazyFlags   m_lazy;
+    mutable u32     m_flagCF;
+    mutable u32     m_flagPF;
+    mutable u32     m_flagZF;
+    mutable u32     m_flagSF;
+    mutable u32     m_flagOF;
+
+    // Software TLB; flushed whenever Section::LayoutVersion() changes
+    mutable TlbEntry    m_tlb[LX_TLB_ENTRIES];
+    mutable u32     m_tlbVersion;
 }; // class CPU
 
 
@@ -603,15 +694,26 @@ INLINE u32 Processor::Offset32( const ARGTYPE &oper ) const
     return offset;
 }
 
-INLINE void Processor::SetFlagPF8( u8 val )
+INLINE pbyte Processor::Translate( u32 address, u32 nBytes, u32 perm ) const
 {
-    int num = 0;
-
-    for (uint i = 0; i < 8; i++) {
-        if (val & (1 << i)) ++num;
+    if (PAGE_LOW(address) > LX_PAGE_SIZE - nBytes) return NULL;
+    if (m_tlbVersion != Section::LayoutVersion()) FlushTlb();
+    const TlbEntry &e = m_tlb[PAGE_NUM(address) & (LX_TLB_ENTRIES - 1)];
+    if (e.Page == PAGE_NUM(address) && (e.Perm & perm)) {
+        return e.Host + PAGE_LOW(address);
     }
+    return TlbFill(address, perm);
+}
+
+INLINE u32 Processor::Offset32( const InstOperand *op ) const
+{
+    // absent base/index registers resolve to the fixed ZERO register
+    return op->Disp + GP_Regs[op->Base].X32 + GP_Regs[op->Index].X32 * op->Scale;
+}
 
-    PF = ((num & 1) == 0);
+INLINE void Processor::SetFlagPF8( u8 val )
+{
+    PF = PARITY8(val);
 }
 
 INLINE void Processor::SetFlagSF8( u8 val )
@@ -659,70 +761,63 @@ INLINE void Processor::SetFlagOF32( u32 val, const i64 &val64 )
     OF = (val64 < MIN_INT32 || val64 > MAX_INT32 || val64 != PROMOTE_I64(val));
 }
 
+INLINE void Processor::SetFlagsLazy( u32 op, u32 width, u32 val, const u64 &uv, const i64 &iv )
+{
+    m_lazy.Op       = op;
+    m_lazy.Width    = width;
+    m_lazy.Result   = val;
+    m_lazy.UResult  = uv;
+    m_lazy.IResult  = iv;
+}
+
 INLINE void Processor::SetFlagsArith8( u8 val, u16 uv16, i16 iv16 )
 {
-    SetFlagCF8(val, uv16);
-    SetFlagOF8(val, iv16);
-    SetFlagZF8(val);
-    SetFlagPF8(val);
-    SetFlagSF8(val);
+    SetFlagsLazy(LX_LAZY_ARITH, 8, val, uv16, iv16);
 }
 
 INLINE void Processor::SetFlagsArith16( u16 val, u32 uv32, i32 iv32 )
 {
-    SetFlagCF16(val, uv32);
-    SetFlagOF16(val, iv32);
-    SetFlagZF16(val);
-    SetFlagPF16(val);
-    SetFlagSF16(val);
+    SetFlagsLazy(LX_LAZY_ARITH, 16, val, uv32, iv32);
 }
 
 INLINE void Processor::SetFlagsArith32( u32 val, const u64 &uv64, const i64 &iv64 )
 {
-    SetFlagCF32(val, uv64);
-    SetFlagOF32(val, iv64);
-    SetFlagZF32(val);
-    SetFlagPF32(val);
-    SetFlagSF32(val);
+    SetFlagsLazy(LX_LAZY_ARITH, 32, val, uv64, iv64);
 }
 
 INLINE void Processor::SetFlagsLogic8( u8 val )
 {
-    SetFlagsShift8(val);
-    OF = CF = 0;
+    SetFlagsLazy(LX_LAZY_LOGIC, 8, val, 0, 0);
 }
 
 INLINE void Processor::SetFlagsLogic16( u16 val )
 {
-    SetFlagsShift16(val);
-    OF = CF = 0;
+    SetFlagsLazy(LX_LAZY_LOGIC, 16, val, 0, 0);
 }
 
 INLINE void Processor::SetFlagsLogic32( u32 val )
 {
-    SetFlagsShift32(val);
-    OF = CF = 0;
+    SetFlagsLazy(LX_LAZY_LOGIC, 32, val, 0, 0);
 }
 
+// Shifts leave CF and OF alone, so whatever is pending has to be evaluated first
+
 INLINE void Processor::SetFlagsShift8( u8 val )
 {
-    SetFlagZF8(val);
-    SetFlagPF8(val);
-    SetFlagSF8(val);
+    SyncFlags();
+    SetFlagsLazy(LX_LAZY_SHIFT, 8, val, 0, 0);
 }
 
 INLINE void Processor::SetFlagsShift16( u16 val )
 {
-    SetFlagZF16(val);
-    SetFlagPF16(val);
-    SetFlagSF16(val);
+    SyncFlags();
+    SetFlagsLazy(LX_LAZY_SHIFT, 16, val, 0, 0);
 }
 
 INLINE void Processor::SetFlagsShift32( u32 val )
 {
-    SetFlagZF32(val);
-    SetFlagPF32(val);
-    SetFlagSF32(val);
+    SyncFlags();
+    SetFlagsLazy(LX_LAZY_SHIFT, 32, val, 0, 0);
 }
 
 
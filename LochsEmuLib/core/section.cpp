@@ -4,10 +4,11 @@
 
 BEGIN_NAMESPACE_LOCHSEMU()
 
+volatile LONG Section::s_layoutVersion = 0;
 
 Section::Section( const SectionDesc &desc, u32 base, u32 size )
 : m_desc(desc), m_base(base), m_size(size), m_pages(PAGE_NUM(size)), 
-PhysAddress((u32) this)
+PhysAddress((u32) this), m_owner(NULL)
 {
     Assert(PAGE_LOW(base) == 0);
     Assert(PAGE_LOW(size) == 0);
@@ -35,9 +36,12 @@ LxResult Section::Commit( u32 addr, u32 size, uint protect )
 
     u32 head = addr - m_base;
     u32 tail = addr - m_base + size - 1;
+    bool reprotect = false;
     for (uint n = PAGE_NUM(head); n <= PAGE_NUM(tail); n++) {
+        if (IsCommitted(n) && m_pageDescTable[n].Protect != protect) reprotect = true;
         SetPageDesc(n, protect, LX_CHR_COMMITTED);
     }
+    if (reprotect) InvalidateLayout();
     LPVOID lpAddr = VirtualAlloc(m_dataPtr + (addr - m_base), size, MEM_COMMIT, PAGE_READWRITE);
     Assert(lpAddr == m_dataPtr + (addr - m_base));
     RET_SUCCESS();
@@ -52,8 +56,10 @@ LxResult Section::Decommit( u32 addr, u32 size )
     u32 head = addr - m_base;
     u32 tail = addr - m_base + size - 1;
     for (uint n = PAGE_NUM(head); n <= PAGE_NUM(tail); n++) {
+        FlushCode(n, n);
         SetPageDesc(n, PAGE_NOACCESS, LX_CHR_RESERVED);
     }
+    InvalidateLayout();
     B( VirtualFree(m_dataPtr + (addr - m_base), size, MEM_DECOMMIT) );
     RET_SUCCESS();
 }
@@ -67,6 +73,8 @@ LxResult Section::Release()
     }
     B( VirtualFree(m_dataPtr, 0, MEM_RELEASE) );
     m_dataPtr = NULL;
+    FlushCode(0, m_pages-1);
+    InvalidateLayout();
     RET_SUCCESS();
 }
 
@@ -75,6 +83,28 @@ void Section::Free()
     B( VirtualFree(m_dataPtr, m_size, MEM_DECOMMIT) );
     B( VirtualFree(m_dataPtr, 0, MEM_RELEASE) );
     m_dataPtr = NULL;
+    FlushCode(0, m_pages-1);
+    InvalidateLayout();
+}
+
+void Section::MarkCode( u32 addr )
+{
+    Assert(Contains(addr));
+    PageDesc &page = m_pageDescTable[PAGE_NUM(addr-m_base)];
+    if (!page.HasCode) {
+        page.HasCode = true;
+        // translations cached with write access must be dropped
+        InvalidateLayout();
+    }
+}
+
+void Section::FlushCode( uint firstPage, uint lastPage )
+{
+    for (uint n = firstPage; n <= lastPage; n++) {
+        if (!m_pageDescTable[n].HasCode) continue;
+        m_pageDescTable[n].HasCode = false;
+        if (m_owner) m_owner->LogCodeWrite(m_base + PAGE_ADDR(n));
+    }
 }
 
 void Section::Copy( u32 addr, u32 size, pbyte data )
@@ -17,6 +17,7 @@ BEGIN_NAMESPACE_LOCHSEMU()
  */
 
 class LX_API Section {
+    friend class Memory;
 public:
     Section(const SectionDesc &desc, u32 base, u32 size);
     virtual ~Section();
@@ -56,6 +57,7 @@ public:
     INLINE bool     IsCommitted(uint pageNum) const;
     INLINE bool     IsAllCommitted() const;
     INLINE pbyte    GetRawData(u32 addr) const;
+    INLINE pbyte    GetAccessPtr(u32 addr, bool write) const;
     INLINE void     Erase();
     INLINE uint     GetPageState(u32 addr) const;
     std::vector<PageInfo>    GetSectionInfo() const;
@@ -71,11 +73,27 @@ public:
     INLINE LxResult Write64(u32 address, const u64 &value);
     INLINE LxResult Write128(u32 address, const u128 &value);
 
+    /*
+     * Bumped whenever a committed page loses access or goes away,
+     * so that processors know to drop their cached translations
+     */
+    static u32      LayoutVersion() { return (u32) s_layoutVersion; }
+
+    /*
+     * Remember that instructions have been decoded from the page of 'addr';
+     * writing to such a page reports it to the owning Memory
+     */
+    void            MarkCode(u32 addr);
+
 protected:
+    static void     InvalidateLayout() { InterlockedIncrement(&s_layoutVersion); }
+
     INLINE void     SetPageDesc(uint pageNum, uint protect, uint chr);
     INLINE bool     CanRead(uint pageNum) const;
     INLINE bool     CanWrite(uint pageNum) const;
     INLINE bool     CanExecute(uint pageNum) const;
+    INLINE void     CheckCode(u32 address, u32 nBytes);
+    void            FlushCode(uint firstPage, uint lastPage);
 
 public:
     const u32       PhysAddress;
@@ -87,6 +105,9 @@ protected:
     u32             m_pages;
     PageDesc *      m_pageDescTable;
     pbyte           m_dataPtr;
+    Memory *        m_owner;
+
+    static volatile LONG    s_layoutVersion;
 };
 
 
@@ -98,6 +119,13 @@ INLINE pbyte Section::GetRawData(u32 addr) const {
     Assert(Contains(addr)); 
     return m_dataPtr + (addr - m_base); 
 }
+INLINE pbyte Section::GetAccessPtr(u32 addr, bool write) const {
+    Assert(Contains(addr));
+    const uint page = PAGE_NUM(addr-m_base);
+    if (!IsCommitted(page)) return NULL;
+    if (write ? !CanWrite(page) || m_pageDescTable[page].HasCode : !CanRead(page)) return NULL;
+    return m_dataPtr + (addr - m_base);
+}
 INLINE void Section::Erase() {
     Assert(IsAllCommitted()); ZeroMemory(m_dataPtr, m_size); 
 }
@@ -187,12 +215,21 @@ INLINE LxResult Section::Read128( u32 address, u128p val ) const
     RET_SUCCESS();
 }
 
+INLINE void Section::CheckCode( u32 address, u32 nBytes )
+{
+    const uint first = PAGE_NUM(address-m_base);
+    const uint last  = min(PAGE_NUM(address-m_base+nBytes-1), m_pages-1);
+    if (m_pageDescTable[first].HasCode || m_pageDescTable[last].HasCode)
+        FlushCode(first, last);
+}
+
 INLINE LxResult Section::Write8( u32 address, u8 value )
 {
     Assert(Contains(address));
     if (!IsCommitted(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     if (!CanWrite(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     *((u8p) (m_dataPtr + (address - m_base))) = value;
+    CheckCode(address, 1);
     RET_SUCCESS();
 }
 
@@ -202,6 +239,7 @@ INLINE LxResult Section::Write16( u32 address, u16 value )
     if (!IsCommitted(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     if (!CanWrite(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     *((u16p) (m_dataPtr + (address - m_base))) = value;
+    CheckCode(address, 2);
     RET_SUCCESS();
 }
 
@@ -211,6 +249,7 @@ INLINE LxResult Section::Write32( u32 address, u32 value )
     if (!IsCommitted(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     if (!CanWrite(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     *((u32p) (m_dataPtr + (address - m_base))) = value;
+    CheckCode(address, 4);
     RET_SUCCESS();
 }
 
@@ -220,6 +259,7 @@ INLINE LxResult Section::Write64( u32 address, const u64 &value )
     if (!IsCommitted(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     if (!CanWrite(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     *((u64p) (m_dataPtr + (address - m_base))) = value;
+    CheckCode(address, 8);
     RET_SUCCESS();
 }
 
@@ -229,6 +269,7 @@ INLINE LxResult Section::Write128(u32 address, const u128 &value)
     if (!IsCommitted(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     if (!CanWrite(PAGE_NUM(address-m_base))) RET_FAIL(LX_RESULT_ACCESS_VIOLATION);
     memcpy(m_dataPtr + (address - m_base), &value, sizeof(u128));
+    CheckCode(address, 16);
     RET_SUCCESS();
 }
 
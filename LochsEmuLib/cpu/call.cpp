@@ -12,7 +12,7 @@ void Processor::Call_E8(const Instruction *inst)
     if (inst->Main.Prefix.OperandSize) {
         NOT_IMPLEMENTED();
     } else {
-        u32 rel32 = (u32) inst->Aux.op1.immediate;
+        u32 rel32 = (u32) inst->Aux.imm1;
         u32 tempEIP = EIP + rel32;
         // TODO
         // if tempEIP not in Code Segment then #GP(0)
@@ -9,13 +9,13 @@ void Processor::Enter_C8(const Instruction *inst)
      * ENTER
      */
     Push32(EBP);
-    u8 nest = (u8) inst->Aux.op2.immediate;
+    u8 nest = (u8) inst->Aux.imm2;
     u32 frameTemp = ESP;
     if (nest > 0) {
         NOT_IMPLEMENTED();
     }
     EBP = frameTemp;
-    ESP -= (u16) inst->Aux.op1.immediate;
+    ESP -= (u16) inst->Aux.imm1;
     
 }
 
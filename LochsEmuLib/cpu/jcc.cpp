@@ -5,7 +5,7 @@ BEGIN_NAMESPACE_LOCHSEMU()
 
 void Processor::JumpRel32(const Instruction *inst)
 {
-    u32 rel = inst->Aux.op1.immediate;
+    u32 rel = inst->Aux.imm1;
     EIP += rel;
 }
 
@@ -10,7 +10,7 @@ void Processor::Jmp_E9(const Instruction *inst)
     /**
      * JMP rel32
      */
-    u32 rel = (u32) inst->Aux.op1.immediate;
+    u32 rel = (u32) inst->Aux.imm1;
     EIP += rel;
     
 }
@@ -20,7 +20,7 @@ void Processor::Jmp_EB(const Instruction *inst)
     /**
      * JMP rel8
      */
-    u32 rel = SIGN_EXTEND(8, 32, inst->Aux.op1.immediate);
+    u32 rel = SIGN_EXTEND(8, 32, inst->Aux.imm1);
     EIP += rel;
     
 }
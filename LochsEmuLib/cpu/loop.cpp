@@ -5,7 +5,7 @@ BEGIN_NAMESPACE_LOCHSEMU()
 
 void Processor::JumpRel8(const Instruction *inst)
 {
-	u32 rel = SIGN_EXTEND(8, 32, inst->Aux.op1.immediate);
+	u32 rel = SIGN_EXTEND(8, 32, inst->Aux.imm1);
 	EIP += rel;
 }
 
@@ -156,6 +156,131 @@ void Processor::Scasb_AE(const Instruction *inst)
     
 }
 
+static INLINE u32 LoadElement(cpbyte p, u32 size)
+{
+    switch (size) {
+    case 1:  return *p;
+    case 2:  return *((const u16 *) p);
+    default: return *((const u32 *) p);
+    }
+}
+
+static INLINE void StoreElement(pbyte p, u32 size, u32 val)
+{
+    switch (size) {
+    case 1:  *p = (u8) val; break;
+    case 2:  *((u16p) p) = (u16) val; break;
+    default: *((u32p) p) = val; break;
+    }
+}
+
+/*
+ * Run a rep-prefixed string instruction over all iterations whose elements
+ * lie in the current source and destination pages, updating ECX, ESI, EDI
+ * and flags as the element-wise loop would.
+ * Returns false if the element-wise path must be taken instead, e.g. on a
+ * page boundary, an inaccessible page, DF set, or plugins watching accesses
+ */
+bool Processor::RepStringBulk(const Instruction *inst, bool repne)
+{
+    if (m_plugins->HasAccessHooks()) return false;
+    if (DF != 0 || ECX == 0) return false;
+    if (inst->Main.Prefix.AddressSize || inst->Main.Prefix.FSPrefix) return false;
 
+    const u32 opcode = inst->Main.Inst.Opcode;
+    bool useSrc, useDst, writeDst = false;
+    switch (opcode) {
+    case 0xa4: case 0xa5: useSrc = true;  useDst = true;  writeDst = true; break;  // movs
+    case 0xaa: case 0xab: useSrc = false; useDst = true;  writeDst = true; break;  // stos
+    case 0xac: case 0xad: useSrc = true;  useDst = false; break;                   // lods
+    case 0xa6: case 0xa7: useSrc = true;  useDst = true;  break;                   // cmps
+    case 0xae: case 0xaf: useSrc = false; useDst = true;  break;                   // scas
+    default:
+        return false;
+    }
+    const bool isCompare = opcode == 0xa6 || opcode == 0xa7 || opcode == 0xae || opcode == 0xaf;
+    if (repne && !isCompare) return false;
+
+    const u32 size = (opcode & 1) ? (inst->Main.Prefix.OperandSize ? 2 : 4) : 1;
+    u32 n = ECX;
+    pbyte ps = NULL, pd = NULL;
+    if (useSrc) {
+        ps = Mem->GetAccessPtr(ESI, false);
+        if (ps == NULL) return false;
+        n = min(n, (LX_PAGE_SIZE - PAGE_LOW(ESI)) / size);
+    }
+    if (useDst) {
+        pd = Mem->GetAccessPtr(EDI, writeDst);
+        if (pd == NULL) return false;
+        n = min(n, (LX_PAGE_SIZE - PAGE_LOW(EDI)) / size);
+    }
+    if (n == 0) return false;   // first element straddles a page boundary
+
+    u32 done = n;
+    switch (opcode) {
+    case 0xa4: case 0xa5:
+        {
+            if (pd > ps && pd < ps + n * size) {
+                // overlapping forward copy replicates the pattern, as the guest expects
+                for (u32 i = 0; i < n; i++) {
+                    memmove(pd + i * size, ps + i * size, size);
+                }
+            } else {
+                memmove(pd, ps, n * size);
+            }
+        } break;
+    case 0xaa: case 0xab:
+        {
+            if (size == 1) {
+                memset(pd, AL, n);
+            } else {
+                for (u32 i = 0; i < n; i++) {
+                    StoreElement(pd + i * size, size, EAX);
+                }
+            }
+        } break;
+    case 0xac: case 0xad:
+        {
+            u32 val = LoadElement(ps + (n - 1) * size, size);
+            if (size == 1)      AL = (u8) val;
+            else if (size == 2) AX = (u16) val;
+            else                EAX = val;
+        } break;
+    default:
+        {
+            // cmps, scas: stop right after the first element ending the loop
+            u32 a = 0, b = 0;
+            if (opcode == 0xae && repne) {
+                cpbyte p = (cpbyte) memchr(pd, AL, n);
+                done = p ? (u32) (p - pd) + 1 : n;
+                a = AL;
+                b = pd[done - 1];
+            } else {
+                const u32 acc = size == 1 ? AL : (size == 2 ? AX : EAX);
+                for (done = 0; done < n; ) {
+                    a = useSrc ? LoadElement(ps + done * size, size) : acc;
+                    b = LoadElement(pd + done * size, size);
+                    done++;
+                    if ((a == b) == repne) break;
+                }
+            }
+            if (size == 1) {
+                SetFlagsArith8((u8) (a - b), PROMOTE_U16(a) - PROMOTE_U16(b),
+                    PROMOTE_I16(a) - PROMOTE_I16(b));
+            } else if (size == 2) {
+                SetFlagsArith16((u16) (a - b), PROMOTE_U32(a) - PROMOTE_U32(b),
+                    PROMOTE_I32(a) - PROMOTE_I32(b));
+            } else {
+                SetFlagsArith32(a - b, PROMOTE_U64(a) - PROMOTE_U64(b),
+                    PROMOTE_I64(a) - PROMOTE_I64(b));
+            }
+        } break;
+    }
+
+    ECX -= done;
+    if (useSrc) ESI += done * size;
+    if (useDst) EDI += done * size;
+    return true;
+}
 
 END_NAMESPACE_LOCHSEMU()
\ No newline at end of file
@@ -17,7 +17,7 @@ void Processor::Fpu_Fadd32fp_D8_0(const Instruction *inst)
 void Processor::Fpu_Fadd_D8C0(const Instruction *inst)
 {
     // FADD ST(0), ST(i)
-    int i = inst->Aux.opcode - 0xc0;
+    int i = inst->Aux.modrm - 0xc0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fadd st, st(0); 
@@ -55,7 +55,7 @@ void Processor::Fpu_Fadd_DC_0(const Instruction *inst)
 void Processor::Fpu_Fadd_DCC0(const Instruction *inst)
 {
     // FADD ST(i), ST(0)
-    int i = inst->Aux.opcode - 0xc0;
+    int i = inst->Aux.modrm - 0xc0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fadd st(0), st; 
@@ -84,7 +84,7 @@ void Processor::Fpu_Fadd_DCC0(const Instruction *inst)
 void Processor::Fpu_Faddp_DEC0(const Instruction *inst)
 {
     // FADDP ST(i), ST(0)
-    int i = inst->Aux.opcode - 0xc0;
+    int i = inst->Aux.modrm - 0xc0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm faddp st(0), st; 
@@ -7,7 +7,7 @@ BEGIN_NAMESPACE_LOCHSEMU()
 void Processor::Fpu_Fcom_D8D0(const Instruction *inst)
 {
     // FCOM ST(0), ST(i)
-    int i = inst->Aux.opcode - 0xd0;
+    int i = inst->Aux.modrm - 0xd0;
     FPU()->RestoreContext();
     switch (i) {
     case 0: __asm fcom st(0); 
@@ -43,7 +43,7 @@ void Processor::Fpu_Fucompp_DAE9(const Instruction *inst)
 
 void Processor::Fpu_Fucomi_DBE8(const Instruction *inst)
 {
-    int i = inst->Aux.opcode - 0xe8;
+    int i = inst->Aux.modrm - 0xe8;
     FPU()->RestoreContext();
 
     switch (i) {
@@ -17,7 +17,7 @@ void Processor::Fpu_Fdiv32fp_D8_6(const Instruction *inst)
 void Processor::Fpu_Fdiv_D8F0(const Instruction *inst)
 {
     // FDIV st(0), st(i)
-    int i = inst->Aux.opcode - 0xf0;
+    int i = inst->Aux.modrm - 0xf0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fdiv st, st(0); 
@@ -87,7 +87,7 @@ void Processor::Fpu_Fdivr_DC_7(const Instruction *inst)
 void Processor::Fpu_Fdivr_DCF0(const Instruction *inst)
 {
     // FDIVR st(i), st(0)
-    int i = inst->Aux.opcode - 0xF0;
+    int i = inst->Aux.modrm - 0xF0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fdivr st(0), st; 
@@ -115,7 +115,7 @@ void Processor::Fpu_Fdivr_DCF0(const Instruction *inst)
 void Processor::Fpu_Fdiv_DCF8(const Instruction *inst)
 {
     // FDIV st(i), st(0)
-    int i = inst->Aux.opcode - 0xF8;
+    int i = inst->Aux.modrm - 0xF8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fdiv st(0), st; 
@@ -144,7 +144,7 @@ void Processor::Fpu_Fdiv_DCF8(const Instruction *inst)
 void Processor::Fpu_Fdivp_DEF8(const Instruction *inst)
 {
     // FDIVP st(i), st(0)
-    int i = inst->Aux.opcode - 0xF8;
+    int i = inst->Aux.modrm - 0xF8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fdivp st(0), st; 
@@ -17,7 +17,7 @@ void Processor::Fpu_Fldcw_D9_5(const Instruction *inst)
 void Processor::Fpu_Fld_D9C0(const Instruction *inst)
 {
     // FLD ST(i)
-    int i = inst->Aux.opcode - 0xC0;
+    int i = inst->Aux.modrm - 0xC0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fld st(0); 
@@ -7,7 +7,7 @@ BEGIN_NAMESPACE_LOCHSEMU()
 void Processor::Fpu_Fmul_D8C8(const Instruction *inst)
 {
     // FMUL ST(0), ST(i)
-    int i = inst->Aux.opcode - 0xc8;
+    int i = inst->Aux.modrm - 0xc8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fmul st, st(0); 
@@ -46,7 +46,7 @@ void Processor::Fpu_Fmul_DC_1(const Instruction *inst)
 void Processor::Fpu_Fmul_DCC8(const Instruction *inst)
 {
     // FMUL ST(i), ST(0)
-    int i = inst->Aux.opcode - 0xc8;
+    int i = inst->Aux.modrm - 0xc8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fmul st(0), st; 
@@ -74,7 +74,7 @@ void Processor::Fpu_Fmul_DCC8(const Instruction *inst)
 void Processor::Fpu_Fmulp_DEC8(const Instruction *inst)
 {
     // FMUL st(i), st(0)
-    int i = inst->Aux.opcode - 0xC8;
+    int i = inst->Aux.modrm - 0xC8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fmulp st(0), st; 
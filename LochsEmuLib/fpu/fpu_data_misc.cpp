@@ -7,7 +7,7 @@ BEGIN_NAMESPACE_LOCHSEMU()
 void Processor::Fpu_Fxch_D9C8(const Instruction *inst)
 {
     // FXCH ST(i)
-    int i = inst->Aux.opcode - 0xC8;
+    int i = inst->Aux.modrm - 0xC8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fxch st(0); 
@@ -634,7 +634,7 @@ Processor::InstHandler *  Processor::Fpu_Handlers[] =
 void Processor::Fpu_Ext(const Instruction *inst)
 {
     Assert(inst->Main.Inst.Opcode >= 0xd8 && inst->Main.Inst.Opcode <= 0xdf);
-    int index = inst->Aux.opcode < 0xc0 ? MASK_MODRM_REG(inst->Aux.opcode) : inst->Aux.opcode - 0xb8;
+    int index = inst->Aux.modrm < 0xc0 ? MASK_MODRM_REG(inst->Aux.modrm) : inst->Aux.modrm - 0xb8;
     Assert(index >= 0 && index < 0x48);
     return (this->*(Fpu_Handlers[inst->Main.Inst.Opcode - 0xd8])[index])(inst);
 }
@@ -64,7 +64,7 @@ void Processor::Fpu_Fstsw_DD_7(const Instruction *inst)
 void Processor::Fpu_Fstp_DDD8(const Instruction *inst)
 {
     // FSTP ST(i)
-    int i = inst->Aux.opcode - 0xd8;
+    int i = inst->Aux.modrm - 0xd8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fstp st(0); 
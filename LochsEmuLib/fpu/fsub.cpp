@@ -7,7 +7,7 @@ BEGIN_NAMESPACE_LOCHSEMU()
 void Processor::Fpu_Fsub_D8E0(const Instruction *inst)
 {
     // FSUB ST(0), ST(i)
-    int i = inst->Aux.opcode - 0xe0;
+    int i = inst->Aux.modrm - 0xe0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fsub st, st(0); 
@@ -35,7 +35,7 @@ void Processor::Fpu_Fsub_D8E0(const Instruction *inst)
 void Processor::Fpu_Fsubr_D8E8(const Instruction *inst)
 {
     // FSUBR ST(0), ST(i)
-    int i = inst->Aux.opcode - 0xe8;
+    int i = inst->Aux.modrm - 0xe8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fsubr st, st(0); 
@@ -83,7 +83,7 @@ void Processor::Fpu_Fsubr_DC_5(const Instruction *inst)
 void Processor::Fpu_Fsubr_DCE0(const Instruction *inst)
 {
     // FSUBR ST(i), ST(0)
-    int i = inst->Aux.opcode - 0xe0;
+    int i = inst->Aux.modrm - 0xe0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fsubr st(0), st; 
@@ -111,7 +111,7 @@ void Processor::Fpu_Fsubr_DCE0(const Instruction *inst)
 void Processor::Fpu_Fsubrp_DEE0(const Instruction *inst)
 {
     // FSUBRP ST(i), ST(0)
-    int i = inst->Aux.opcode - 0xe0;
+    int i = inst->Aux.modrm - 0xe0;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fsubrp st(0), st; 
@@ -139,7 +139,7 @@ void Processor::Fpu_Fsubrp_DEE0(const Instruction *inst)
 void Processor::Fpu_Fsubp_DEE8(const Instruction *inst)
 {
     // FSUBP ST(i), ST(0)
-    int i = inst->Aux.opcode - 0xe8;
+    int i = inst->Aux.modrm - 0xe8;
     FPU()->RestoreContext();
     switch (i) {
         case 0: __asm fsubp st(0), st; 
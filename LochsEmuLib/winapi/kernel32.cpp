@@ -883,7 +883,7 @@ uint Kernel32_GlobalAlloc(Processor *cpu)
 	DWORD dwFlag = (DWORD) PARAM(0);
 	SIZE_T dwBytes = (SIZE_T) PARAM(1);
 	
-	RET_VALUE = (u32) heap->HeapAlloc(dwBytes, dwFlag, cpu);
+	RET_VALUE = (u32) heap->HeapAlloc(dwBytes, (dwFlag & GMEM_ZEROINIT) ? HEAP_ZERO_MEMORY : 0, cpu);
 	RET_PARAMS(2);
 }
 
@@ -1016,8 +1016,9 @@ uint Kernel32_HeapValidate(Processor *cpu)
 {
     SyncObjectLock lock(*cpu->Mem);
 
-	RET_VALUE = (u32) HeapValidate(
-		(HANDLE)PARAM(0), (DWORD)PARAM(1), (LPCVOID)PARAM_PTR(2));
+    Heap *h = LxEmulator.Proc()->GetHeap(PARAM(0));
+    Assert(h);
+	RET_VALUE = (u32) h->HeapValidate(PARAM(2), PARAM(1), cpu);
 	RET_PARAMS(3);
 }
 
@@ -300,14 +300,9 @@ void ProDebugger::UpdateTraceContext( const Processor *cpu, TraceContext *ctx, u
     ctx->Flags[InstContext::AF]         = m_cpu[cpu->IntID]->AF;
     ctx->Flags[InstContext::PF]         = m_cpu[cpu->IntID]->PF;
     ctx->Flags[InstContext::CF]         = m_cpu[cpu->IntID]->CF;
+    ctx->Flags[InstContext::DF]         = m_cpu[cpu->IntID]->DF;
 
-    uint module             = m_cpu[cpu->IntID]->GetModule(eip);
-    const ModuleInfo *minfo = m_cpu[cpu->IntID]->Proc()->GetModuleInfo(module);
-    ctx->ModuleName         = minfo->Name;
-    ctx->ModuleImageBase    = minfo->ImageBase;
-
-    ctx->MRs = m_mrs[cpu->IntID];
-    ctx->MWs = m_mws[cpu->IntID];
+    // module and memory accesses are filled in by ProTracer
 
     ctx->Tid = cpu->IntID;
     ctx->ExternalTid = cpu->Thr()->ExtID;
@@ -63,6 +63,8 @@ public:
     void        UpdateInstContext(const Processor *cpu, InstContext *ctx) const;
     void        UpdateTraceContext(const Processor *cpu, TraceContext *ctx, u32 eip) const;
     void        UpdateTContext(const Processor *cpu, TContext *ctx) const;
+    const std::vector<MemAccess> &  GetMemReads(const Processor *cpu) const { return m_mrs[cpu->IntID]; }
+    const std::vector<MemAccess> &  GetMemWrites(const Processor *cpu) const { return m_mws[cpu->IntID]; }
 
     void        Serialize(Json::Value &root) const override;
     void        Deserialize(Json::Value &root) override;
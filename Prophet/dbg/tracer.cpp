@@ -4,33 +4,51 @@
 #include "processor.h"
 #include "engine.h"
 #include "event.h"
+#include "process.h"
+#include "pemodule.h"
+#include "debugger.h"
+#include "protocol/tracefile.h"
 
 ProTracer::ProTracer( ProEngine *engine )
     : m_engine(engine),  m_seq(-1)
 {
     m_mainModuleOnly = false;
+    m_keepHistory = false;
     m_traces    = NULL;
     m_maxTraces = 100000;
     m_ptr       = 0;
     m_count     = 0;
+    m_serial    = 0;
+    m_regChanged = NULL;
+    m_freeBlock = -1;
+    m_history   = NULL;
 }
 
 ProTracer::~ProTracer()
 {
     SAFE_DELETE_ARRAY(m_traces);
+    SAFE_DELETE_ARRAY(m_regChanged);
+    SAFE_DELETE(m_history);
 }
 
 void ProTracer::OnProcessPostLoad( ProcessPostLoadEvent &event )
 {
     LxDebug("Allocating spaces for %d traces\n", m_maxTraces);
     m_traces = new TraceContext[m_maxTraces];
+    m_regChanged = new u8[m_maxTraces];
+
+    // most traces read or write once and change a register or two
+    m_readIndex.Reserve(m_maxTraces);
+    m_writeIndex.Reserve(m_maxTraces);
+    m_valueIndex.Reserve(m_maxTraces * 2);
+
+    if (m_keepHistory)
+        LoadHistory();
 }
 
 void ProTracer::OnPreExecute( PreExecuteEvent &event )
 {
     //m_currEip   = event.Cpu->EIP;
-    if (!IsEnabled()) return;
-    m_currTrace.Reset();
 }
 
 void ProTracer::OnPostExecute( PostExecuteEvent &event )
@@ -41,19 +59,234 @@ void ProTracer::OnPostExecute( PostExecuteEvent &event )
     if (m_mainModuleOnly && event.Cpu->GetCurrentModule() != 0)
         return; // skip DLLs
 
-    m_engine->GetTraceContext(event.Cpu, &m_currTrace, event.Cpu->GetPrevEip());
-    m_currTrace.Seq     = m_seq;
-    AddTrace(m_currTrace);
+    SyncObjectLock lock(*this);
+
+    // fill the next slot in place, nothing here allocates once the arenas are warm
+    u32 eip = event.Cpu->GetPrevEip();
+    TraceContext &t = NextSlot();
+    m_engine->GetTraceContext(event.Cpu, &t, eip);
+    t.Seq   = m_seq;
+
+    uint module = event.Cpu->GetModule(eip);
+    const ModuleInfo *minfo = event.Cpu->Proc()->GetModuleInfo(module);
+    t.Module            = InternModule(module, minfo);
+    t.ModuleImageBase   = minfo->ImageBase;
+
+    const ProDebugger *dbg = m_engine->GetDebugger();
+    StoreAccesses(t, dbg->GetMemReads(event.Cpu), dbg->GetMemWrites(event.Cpu));
+    AddTrace();
 }
 
-void ProTracer::AddTrace( const TraceContext &t )
+TraceContext & ProTracer::NextSlot()
 {
-    SyncObjectLock lock(*this);
-    m_traces[m_ptr++] = t;
+    if (m_count == m_maxTraces) {
+        EvictTrace(m_traces[m_ptr], m_regChanged[m_ptr], m_serial - m_count);
+        FreeBlocks(m_traces[m_ptr].Overflow);
+        m_count--;
+    }
+    return m_traces[m_ptr];
+}
+
+void ProTracer::AddTrace()
+{
+    const TraceContext &t = m_traces[m_ptr];
+
+    u8 regChanged = 0xff;
+    if (m_count > 0) {
+        const TraceContext &prev = GetTrace(m_count - 1);
+        regChanged = 0;
+        for (int r = 0; r < t.RegCount; r++)
+            if (t.Regs[r] != prev.Regs[r]) regChanged |= 1 << r;
+    }
+
+    m_regChanged[m_ptr] = regChanged;
+    IndexTrace(t, regChanged, m_serial++);
+    m_ptr++;
     if (m_ptr >= m_maxTraces)
         m_ptr = 0;
-    if (m_count < m_maxTraces)
-        m_count++;
+    m_count++;
+}
+
+void ProTracer::StoreAccesses( TraceContext &t, const std::vector<MemAccess> &mrs, 
+                               const std::vector<MemAccess> &mws )
+{
+    t.NumMRs    = (u16) min((uint) mrs.size(), 0xffffu);
+    t.NumMWs    = (u16) min((uint) mws.size(), 0xffffu - t.NumMRs);
+    t.Overflow  = -1;
+
+    int block = -1;
+    int total = t.NumMRs + t.NumMWs;
+    for (int i = 0; i < total; i++) {
+        const MemAccess &ma = i < t.NumMRs ? mrs[i] : mws[i - t.NumMRs];
+        if (i < TraceContext::InlineAccesses) {
+            t.Accesses[i] = ma;
+            continue;
+        }
+        int pos = (i - TraceContext::InlineAccesses) % BlockAccesses;
+        if (pos == 0) {
+            // take a block from the free list, grow the arena only when it is empty
+            int b = m_freeBlock;
+            if (b == -1) {
+                b = (int) m_blocks.size();
+                m_blocks.push_back(AccessBlock());
+            } else {
+                m_freeBlock = m_blocks[b].Next;
+            }
+            m_blocks[b].Next = -1;
+            if (block == -1) t.Overflow = b;
+            else m_blocks[block].Next = b;
+            block = b;
+        }
+        m_blocks[block].Data[pos] = ma;
+    }
+}
+
+const MemAccess & ProTracer::GetAccess( const TraceContext &t, int n ) const
+{
+    if (n < TraceContext::InlineAccesses) return t.Accesses[n];
+    n -= TraceContext::InlineAccesses;
+    int b = t.Overflow;
+    for (; n >= BlockAccesses; n -= BlockAccesses)
+        b = m_blocks[b].Next;
+    return m_blocks[b].Data[n];
+}
+
+void ProTracer::FreeBlocks( int first )
+{
+    while (first != -1) {
+        int next = m_blocks[first].Next;
+        m_blocks[first].Next = m_freeBlock;
+        m_freeBlock = first;
+        first = next;
+    }
+}
+
+u16 ProTracer::InternModule( uint module, const ModuleInfo *minfo )
+{
+    if (module < m_moduleIds.size() && m_moduleIds[module] != -1 && 
+        m_moduleBases[m_moduleIds[module]] == minfo->ImageBase)
+        return (u16) m_moduleIds[module];
+
+    // first time seen, or the emulator reused the number for another module
+    if (module >= m_moduleIds.size())
+        m_moduleIds.resize(module + 1, -1);
+    m_moduleIds[module] = InternModule(minfo->Name, minfo->ImageBase);
+    return (u16) m_moduleIds[module];
+}
+
+u16 ProTracer::InternModule( const std::string &name, u32 imageBase )
+{
+    for (uint i = 0; i < m_modules.size(); i++)
+        if (m_modules[i] == name && m_moduleBases[i] == imageBase) return (u16) i;
+    m_modules.push_back(name);
+    m_moduleBases.push_back(imageBase);
+    return (u16) (m_modules.size() - 1);
+}
+
+void ProTracer::SaveHistory()
+{
+    if (!m_keepHistory || m_count == 0) return;
+
+    std::string path = m_engine->GetHistoryPath();
+    LxInfo("Saving %d traces to %s\n", m_count, path.c_str());
+    TraceContextWriter(path).Write(*this);
+}
+
+void ProTracer::LoadHistory()
+{
+    std::string path = m_engine->GetHistoryPath();
+    if (!LxFileExists(path.c_str())) return;
+
+    TraceContextReader *reader = new TraceContextReader(path);
+    if (!reader->IsValid()) {
+        LxWarning("Invalid trace history %s, ignored\n", path.c_str());
+        delete reader;
+        return;
+    }
+
+    SyncObjectLock lock(*this);
+    LxInfo("Loading %d traces from %s\n", reader->GetCount(), path.c_str());
+
+    // the loaded traces go through the ring like recorded ones, their instructions
+    // stay in the reader's pool
+    std::vector<int> modules;   // module of the file -> interned, -1 if none yet
+    std::vector<MemAccess> mrs, mws;
+    for (int i = 0; i < reader->GetCount(); i++) {
+        const TraceContext &src = reader->GetTrace(i);
+        if (src.Module >= modules.size())
+            modules.resize(src.Module + 1, -1);
+        if (modules[src.Module] == -1)
+            modules[src.Module] = InternModule(reader->GetModuleName(src), src.ModuleImageBase);
+
+        mrs.clear();
+        mws.clear();
+        for (int n = 0; n < src.NumMRs; n++) mrs.push_back(reader->GetMr(src, n));
+        for (int n = 0; n < src.NumMWs; n++) mws.push_back(reader->GetMw(src, n));
+
+        TraceContext &t = NextSlot();
+        t = src;
+        t.Module = (u16) modules[src.Module];
+        StoreAccesses(t, mrs, mws);
+        AddTrace();
+    }
+    m_history = reader;
+
+    // the new run numbers on from the saved one, so that Seq keeps growing along the ring
+    if (m_count > 0)
+        m_seq = max(m_seq, GetTrace(m_count - 1).Seq);
+}
+
+void ProTracer::GetInstContext( int n, InstContext *ctx ) const
+{
+    const TraceContext &t = GetTrace(n);
+    ctx->Reset();
+    memcpy(ctx->Regs, t.Regs, sizeof(ctx->Regs));
+    ctx->Eip    = t.Eip;
+    for (int i = 0; i < t.FlagCount; i++)
+        ctx->Flags[i] = t.Flags[i];
+    ctx->ModuleName         = GetModuleName(t);
+    ctx->ModuleImageBase    = t.ModuleImageBase;
+    ctx->Inst               = t.Inst;
+    ctx->JumpTaken          = t.JumpTaken;
+    for (int i = 0; i < t.NumMRs; i++)
+        ctx->MRs.push_back(GetMr(t, i));
+    for (int i = 0; i < t.NumMWs; i++)
+        ctx->MWs.push_back(GetMw(t, i));
+    ctx->Tid            = t.Tid;
+    ctx->ExternalTid    = t.ExternalTid;
+}
+
+void ProTracer::IndexTrace( const TraceContext &t, u8 regChanged, i64 serial )
+{
+    for (int r = 0; r < t.RegCount; r++)
+        if (regChanged & (1 << r)) m_valueIndex.Push(t.Regs[r], serial);
+    for (int i = 0; i < t.NumMRs; i++) {
+        const MemAccess &mr = GetMr(t, i);
+        m_readIndex.Push(mr.Addr, serial);
+        if (mr.Len == 4) m_valueIndex.Push(mr.Val, serial);
+    }
+    for (int i = 0; i < t.NumMWs; i++) {
+        const MemAccess &mw = GetMw(t, i);
+        m_writeIndex.Push(mw.Addr, serial);
+        if (mw.Len == 4) m_valueIndex.Push(mw.Val, serial);
+    }
+}
+
+void ProTracer::EvictTrace( const TraceContext &t, u8 regChanged, i64 serial )
+{
+    // the oldest trace goes, so its serial is at the front of every list it is in
+    for (int r = 0; r < t.RegCount; r++)
+        if (regChanged & (1 << r)) m_valueIndex.Pop(t.Regs[r], serial);
+    for (int i = 0; i < t.NumMRs; i++) {
+        const MemAccess &mr = GetMr(t, i);
+        m_readIndex.Pop(mr.Addr, serial);
+        if (mr.Len == 4) m_valueIndex.Pop(mr.Val, serial);
+    }
+    for (int i = 0; i < t.NumMWs; i++) {
+        const MemAccess &mw = GetMw(t, i);
+        m_writeIndex.Pop(mw.Addr, serial);
+        if (mw.Len == 4) m_valueIndex.Pop(mw.Val, serial);
+    }
 }
 
 const TraceContext & ProTracer::GetTrace( int n ) const
@@ -69,6 +302,7 @@ void ProTracer::Serialize( Json::Value &root ) const
     root["enabled"]             = m_enabled;
     root["main_module_only"]    = m_mainModuleOnly;
     root["max_traces"]          = m_maxTraces;
+    root["keep_history"]        = m_keepHistory;
 }
 
 void ProTracer::Deserialize( Json::Value &root )
@@ -76,6 +310,7 @@ void ProTracer::Deserialize( Json::Value &root )
     m_enabled = root.get("enabled", m_enabled).asBool();
     m_mainModuleOnly = root.get("main_module_only", m_mainModuleOnly).asBool();
     m_maxTraces = root.get("max_traces", m_maxTraces).asInt();
+    m_keepHistory = root.get("keep_history", m_keepHistory).asBool();
 }
 
 void ProTracer::Enable( bool isEnabled )
@@ -86,41 +321,158 @@ void ProTracer::Enable( bool isEnabled )
 
 int ProTracer::FindFirstReg( u32 val ) const
 {
-    for (int i = 0; i < m_count; i++) {
-        const TraceContext &t = GetTrace(i);
-        for (int r = 0; r < t.RegCount; r++) {
-            if (t.Regs[r] == val) return i;
-        }
-        for (auto &mr : t.MRs)
-            if (mr.Len == 4 && mr.Val == val) return i;
-        for (auto &mw : t.MWs)
-            if (mw.Len == 4 && mw.Val == val) return i;
+    if (m_count == 0) return -1;
+
+    // registers of the oldest trace hold values loaded before it, check them directly
+    const TraceContext &t = GetTrace(0);
+    for (int r = 0; r < t.RegCount; r++) {
+        if (t.Regs[r] == val) return 0;
     }
-    return -1;
+
+    i64 serial = m_valueIndex.Oldest(val);
+    return serial < 0 ? -1 : SerialToIndex(serial);
+}
+
+int ProTracer::FindMostRecent( const SerialIndex &index, u32 addr, int idxFrom ) const
+{
+    i64 serial = index.MostRecentBefore(addr, m_serial - m_count + idxFrom);
+    return serial < 0 ? -1 : SerialToIndex(serial);
 }
 
 int ProTracer::FindMostRecentMrAddr( u32 addr, int idxFrom ) const
 {
-    int index = idxFrom - 1;
-    while (index >= 0) {
-        for (auto &mr : GetTrace(index).MRs) {
-            if (mr.Addr == addr) return index;
-        }
-        index--;
-    }
-    return -1;
+    return FindMostRecent(m_readIndex, addr, idxFrom);
 }
 
 int ProTracer::FindMostRecentMwAddr( u32 addr, int idxFrom ) const
 {
-    int index = idxFrom - 1;
-    while (index >= 0) {
-        for (auto &mw : GetTrace(index).MWs) {
-            if (mw.Addr == addr) return index;
+    return FindMostRecent(m_writeIndex, addr, idxFrom);
+}
+
+/*
+ * SerialIndex
+ */
+
+SerialIndex::SerialIndex()
+{
+    m_freeNode  = -1;
+    m_used      = 0;
+    Rehash(16);
+}
+
+void SerialIndex::Reserve( int keys )
+{
+    uint capacity = 16;
+    while (capacity < (uint) keys * 2)
+        capacity <<= 1;
+    if (capacity > m_slots.size())
+        Rehash(capacity);
+    m_nodes.reserve(keys);
+}
+
+int SerialIndex::Find( u32 key ) const
+{
+    const uint mask = m_slots.size() - 1;
+    for (uint i = Home(key); ; i = (i + 1) & mask) {
+        if (m_slots[i].Oldest == -1 || m_slots[i].Key == key)
+            return (int) i;
+    }
+}
+
+void SerialIndex::Rehash( uint capacity )
+{
+    std::vector<Slot> old;
+    old.swap(m_slots);
+    Slot empty = { 0, -1, -1 };
+    m_slots.assign(capacity, empty);
+    for (uint i = 0; i < old.size(); i++) {
+        if (old[i].Oldest != -1)
+            m_slots[Find(old[i].Key)] = old[i];
+    }
+}
+
+void SerialIndex::Erase( uint slot )
+{
+    // shift back the slots after it that would no longer be reachable
+    const uint mask = m_slots.size() - 1;
+    uint hole = slot;
+    for (uint i = (slot + 1) & mask; m_slots[i].Oldest != -1; i = (i + 1) & mask) {
+        uint home = Home(m_slots[i].Key);
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            m_slots[hole] = m_slots[i];
+            hole = i;
         }
-        index--;
     }
-    return -1;
+    m_slots[hole].Oldest = m_slots[hole].Newest = -1;
+    m_used--;
+}
+
+int SerialIndex::NewNode( i64 serial )
+{
+    int n = m_freeNode;
+    if (n == -1) {
+        n = (int) m_nodes.size();
+        m_nodes.push_back(Node());
+    } else {
+        m_freeNode = m_nodes[n].Newer;
+    }
+    m_nodes[n].Serial   = serial;
+    m_nodes[n].Older    = -1;
+    m_nodes[n].Newer    = -1;
+    return n;
+}
+
+void SerialIndex::Push( u32 key, i64 serial )
+{
+    int slot = Find(key);
+    Slot &s = m_slots[slot];
+    if (s.Oldest != -1) {
+        // a key repeated within one trace is indexed once
+        if (m_nodes[s.Newest].Serial == serial) return;
+        int n = NewNode(serial);
+        m_nodes[n].Older = s.Newest;
+        m_nodes[s.Newest].Newer = n;
+        s.Newest = n;
+        return;
+    }
+
+    s.Key = key;
+    s.Oldest = s.Newest = NewNode(serial);
+    if (++m_used * 2 > m_slots.size())
+        Rehash(m_slots.size() * 2);
+}
+
+void SerialIndex::Pop( u32 key, i64 serial )
+{
+    // a key repeated within one trace was indexed once
+    int slot = Find(key);
+    Slot &s = m_slots[slot];
+    if (s.Oldest == -1 || m_nodes[s.Oldest].Serial != serial) return;
+
+    int n = s.Oldest;
+    s.Oldest = m_nodes[n].Newer;
+    m_nodes[n].Newer = m_freeNode;
+    m_freeNode = n;
+    if (s.Oldest == -1) {
+        Erase(slot);
+    } else {
+        m_nodes[s.Oldest].Older = -1;
+    }
 }
 
+i64 SerialIndex::Oldest( u32 key ) const
+{
+    const Slot &s = m_slots[Find(key)];
+    return s.Oldest == -1 ? -1 : m_nodes[s.Oldest].Serial;
+}
 
+i64 SerialIndex::MostRecentBefore( u32 key, i64 serial ) const
+{
+    // lookups start close to the newest trace, walk back from there
+    const Slot &s = m_slots[Find(key)];
+    if (s.Oldest == -1) return -1;
+    for (int n = s.Newest; n != -1; n = m_nodes[n].Older) {
+        if (m_nodes[n].Serial < serial) return m_nodes[n].Serial;
+    }
+    return -1;
+}
@@ -9,19 +9,81 @@
 #include "instcontext.h"
 #include "utilities.h"
 
-struct TraceContext : public InstContext {
-    i64     Seq;
+class TraceContextReader;
 
-    TraceContext() : Seq(-1) 
-    {
-    }
+/*
+ * Fixed-size record of one traced instruction, so that recording one never
+ * allocates. The module is interned by ProTracer (see GetModuleName), memory
+ * accesses (reads first, then writes) are stored inline, the ones that don't
+ * fit go to the tracer's overflow arena (see GetMr and GetMw)
+ */
+struct TraceContext {
+    static const int    RegCount        = InstContext::RegCount;
+    static const int    FlagCount       = InstContext::FlagCount;
+    static const int    InlineAccesses  = 3;
+
+    i64         Seq;
+    u32         Regs[RegCount];
+    u32         Eip;
+    u8          Flags[FlagCount];
+    bool        JumpTaken;
+    u16         Module;
+    u32         ModuleImageBase;
+    InstPtr     Inst;
+    int         Tid;
+    ThreadID    ExternalTid;
 
-    void    Reset() {
-        InstContext::Reset();
-        Seq = 0;
+    u16         NumMRs;
+    u16         NumMWs;
+    int         Overflow;       // first arena block, -1 if none
+    MemAccess   Accesses[InlineAccesses];
+
+    TraceContext() : Seq(-1), Overflow(-1) 
+    {
     }
 };
 
+/*
+ * Serials (count of traces added before) of the live traces per key, an address
+ * or a value, oldest first
+ * The lists are linked through a node pool and found through an open addressing
+ * table; both are reserved up front and reused as traces are evicted, so that
+ * nothing allocates once they are warm
+ */
+class SerialIndex {
+public:
+    SerialIndex();
+
+    void            Reserve(int keys);
+    void            Push(u32 key, i64 serial);
+    void            Pop(u32 key, i64 serial);
+    i64             Oldest(u32 key) const;
+    i64             MostRecentBefore(u32 key, i64 serial) const;
+
+private:
+    struct Node {
+        i64         Serial;
+        int         Older;
+        int         Newer;          // next free node while on the free list
+    };
+    struct Slot {
+        u32         Key;
+        int         Oldest;         // -1 if the slot is empty
+        int         Newest;
+    };
+
+    uint            Home(u32 key) const { return (key * 2654435761u) & (m_slots.size() - 1); }
+    int             Find(u32 key) const;
+    void            Erase(uint slot);
+    void            Rehash(uint capacity);
+    int             NewNode(i64 serial);
+
+private:
+    std::vector<Slot>   m_slots;
+    std::vector<Node>   m_nodes;
+    int             m_freeNode;
+    uint            m_used;
+};
 
 class ProTracer : public MutexSyncObject, public ISerializable {
 public:
@@ -34,6 +96,16 @@ public:
 
     int             GetCount() const { return m_count; }
     const TraceContext &    GetTrace(int n) const;
+    const MemAccess &   GetMr(const TraceContext &t, int n) const {
+        Assert(n >= 0 && n < t.NumMRs);
+        return GetAccess(t, n);
+    }
+    const MemAccess &   GetMw(const TraceContext &t, int n) const {
+        Assert(n >= 0 && n < t.NumMWs);
+        return GetAccess(t, t.NumMRs + n);
+    }
+    const std::string & GetModuleName(const TraceContext &t) const { return m_modules[t.Module]; }
+    void            GetInstContext(int n, InstContext *ctx) const;
 
     int             FindFirstReg(u32 val) const;
     int             FindMostRecentMrAddr(u32 addr, int idxFrom) const;
@@ -42,21 +114,68 @@ public:
     void            Enable(bool isEnabled);
     bool            IsEnabled() const { return m_enabled; }
 
+    /*
+     * With keep_history set, the traces are saved with the archive and loaded
+     * back into the ring, ahead of the new ones, when the process is loaded again
+     */
+    void            SaveHistory();
+
     void            Serialize(Json::Value &root) const override;
     void            Deserialize(Json::Value &root) override;
 private:
-    void            AddTrace(const TraceContext &t);
+    /*
+     * Arena block for the accesses of a trace beyond the inline ones
+     */
+    static const int    BlockAccesses = 15;
+    struct AccessBlock {
+        MemAccess   Data[BlockAccesses];
+        int         Next;
+    };
+
+    TraceContext &  NextSlot();
+    void            AddTrace();
+    void            StoreAccesses(TraceContext &t, const std::vector<MemAccess> &mrs,
+                                  const std::vector<MemAccess> &mws);
+    const MemAccess &   GetAccess(const TraceContext &t, int n) const;
+    void            FreeBlocks(int first);
+    u16             InternModule(uint module, const ModuleInfo *minfo);
+    u16             InternModule(const std::string &name, u32 imageBase);
+    void            LoadHistory();
+    void            IndexTrace(const TraceContext &t, u8 regChanged, i64 serial);
+    void            EvictTrace(const TraceContext &t, u8 regChanged, i64 serial);
+    int             FindMostRecent(const SerialIndex &index, u32 addr, int idxFrom) const;
+    int             SerialToIndex(i64 serial) const { return (int) (serial - (m_serial - m_count)); }
+
 private:
-    TraceContext    m_currTrace;
     //u32             m_currEip;
     i64             m_seq;
     bool            m_enabled;
     bool            m_mainModuleOnly;
+    bool            m_keepHistory;
     ProEngine *     m_engine;
     int             m_maxTraces;
     TraceContext *  m_traces;
     int             m_ptr;
     int             m_count;
+
+    /*
+     * Indexes over the live traces, kept up to date by AddTrace: the reads and
+     * the writes of every address, and where each value shows up first, either
+     * loaded into a register (a change from the previous trace) or as a dword
+     * read or written
+     */
+    i64             m_serial;
+    u8 *            m_regChanged;       // per slot, registers changed by that trace
+    SerialIndex     m_readIndex;
+    SerialIndex     m_writeIndex;
+    SerialIndex     m_valueIndex;
+
+    std::vector<AccessBlock>    m_blocks;
+    int             m_freeBlock;        // free list through AccessBlock::Next
+    std::vector<std::string>    m_modules;
+    std::vector<u32>            m_moduleBases;  // per interned module
+    std::vector<int>            m_moduleIds;    // emulator module -> interned, -1 if none yet
+    TraceContextReader *        m_history;      // owns the instructions of the loaded traces
 };
 
 #endif // __PROPHET_TRACER_H__
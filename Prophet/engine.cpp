@@ -6,6 +6,7 @@
 #include "gui/mainframe.h"
 #include "gui/cpupanel.h"
 #include "gui/tracepanel.h"
+#include "protocol/taint/taintbits.h"
 
 #include "instruction.h"
 #include "processor.h"
@@ -35,6 +36,12 @@ void ProEngine::Initialize(Emulator *emu)
 {
     Intro();
     m_emulator      = emu;
+    InitTaintBits();
+#ifdef _DEBUG
+    if (!CheckTaintBits()) {
+        LxFatal("Vectorized taint bit kernels disagree with the scalar ones\n");
+    }
+#endif
     m_statistics.Initialize();
     m_debugger.Initialize();
     m_disassembler.Initialize();
@@ -262,7 +269,7 @@ void ProEngine::GetInstContext(const Processor *cpu, InstContext *ctx) const
 
 void ProEngine::GetTraceContext( const Processor *cpu, TraceContext *ctx, u32 eip ) const
 {
-    m_disassembler.UpdateInstContext(ctx, eip);
+    m_disassembler.UpdateTraceContext(ctx, eip);
     m_debugger.UpdateTraceContext(cpu, ctx, eip);
 }
 
@@ -342,6 +349,8 @@ void ProEngine::SaveArchive()
     std::ofstream fout(m_archivePath);
     fout << str;
     fout.close();
+
+    m_tracer.SaveHistory();
 }
 
 void ProEngine::UpdateGUI()
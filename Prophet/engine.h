@@ -75,6 +75,7 @@ public:
 
     std::string     GetArchiveDir() const { return m_archiveDir; }
     std::string     GetArchiveFileName() const { return m_archiveFileName; }
+    std::string     GetHistoryPath() const { return m_archiveDir + m_archiveFileName + ".ptc"; }
     
 private:
     void            Intro() const;
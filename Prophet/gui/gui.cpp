@@ -74,22 +74,13 @@ void DrawTaint( wxBufferedPaintDC &dc, const Taint &t, const wxRect &rect, bool
         dc.SetBrush(*wxBLUE_BRUSH);
         const int TaintWidth = t.GetWidth();
         const float w = rectTaint.width / (float) TaintWidth;
-        
-        bool currTainted = t.IsTainted(0);
-        int taintedStart = 0;
-        for (int i = 0; i < TaintWidth; i++) {
-            if (t.IsTainted(i)) {
-                if (!currTainted) {
-                    currTainted = true;
-                    taintedStart = i;
-                }
-            } 
-            if (currTainted && (!t.IsTainted(i) || i == TaintWidth-1)) {
-                int xOffset = static_cast<int>(w * taintedStart + 0.5f);
-                int width = max(static_cast<int>(w * (i - taintedStart) + 0.5f), 2);
-                dc.DrawRectangle(rectTaint.x + xOffset, rectTaint.y, width, rectTaint.height);
-                currTainted = false;
-            }
+
+        // only the tainted runs, the label space can be far wider than what is set
+        auto regions = t.GenerateRegions();
+        for (auto &r : regions) {
+            int xOffset = static_cast<int>(w * r.Offset + 0.5f);
+            int width = max(static_cast<int>(w * r.Len + 0.5f), 2);
+            dc.DrawRectangle(rectTaint.x + xOffset, rectTaint.y, width, rectTaint.height);
         }
     }
 
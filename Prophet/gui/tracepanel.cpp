@@ -103,15 +103,20 @@ void TracePanel::DrawTrace( wxBufferedPaintDC &dc, const TraceContext &trace, in
     dc.DrawText(trace.Inst->Main.CompleteInstr, w, h);
     w += m_widthDisasm;
     wxString m;
-    if (trace.MRs.size() > 0) {
+    const ProTracer *tracer = m_parent->m_tracer;
+    if (trace.NumMRs > 0) {
         m += "MR: ";
-        for (auto &mr : trace.MRs)
+        for (int i = 0; i < trace.NumMRs; i++) {
+            const MemAccess &mr = tracer->GetMr(trace, i);
             m += wxString::Format("%08x(%d):%08x, ", mr.Addr, mr.Len, mr.Val);
+        }
     }
-    if (trace.MWs.size() > 0) {
+    if (trace.NumMWs > 0) {
         m += "MW: ";
-        for (auto &mw : trace.MWs)
+        for (int i = 0; i < trace.NumMWs; i++) {
+            const MemAccess &mw = tracer->GetMw(trace, i);
             m += wxString::Format("%08x(%d):%08x, ", mw.Addr, mw.Len, mw.Val);
+        }
     }
 
     dc.DrawText(m, w, h);
@@ -140,9 +145,10 @@ void TracePanel::OnSelectionChange()
     //const ProTracer::TraceVec &vec = m_parent->m_tracer->GetData();
 
     if (m_currSelIndex >= m_parent->m_tracer->GetCount() || m_currSelIndex < 0) return;
-    const TraceContext &ctx = m_parent->m_tracer->GetTrace(m_currSelIndex);
+    InstContext ctx;
+    m_parent->m_tracer->GetInstContext(m_currSelIndex, &ctx);
 
-    wxString desc = wxString::Format("Traced #%I64d", ctx.Seq);
+    wxString desc = wxString::Format("Traced #%I64d", m_parent->m_tracer->GetTrace(m_currSelIndex).Seq);
     m_parent->m_contextPanel->UpdateData(&ctx, desc.ToAscii());
 }
 
@@ -152,9 +158,10 @@ void TracePanel::SelectIndex( int index )
     m_currSelIndex = index;
 
     if (m_currSelIndex >= m_parent->m_tracer->GetCount() || m_currSelIndex < 0) return;
-    const TraceContext &ctx = m_parent->m_tracer->GetTrace(m_currSelIndex);
+    InstContext ctx;
+    m_parent->m_tracer->GetInstContext(m_currSelIndex, &ctx);
 
-    wxString desc = wxString::Format("Traced #%I64d", ctx.Seq);
+    wxString desc = wxString::Format("Traced #%I64d", m_parent->m_tracer->GetTrace(m_currSelIndex).Seq);
     m_parent->m_contextPanel->UpdateData(&ctx, desc.ToAscii());
 
     Scroll(0, m_currSelIndex);
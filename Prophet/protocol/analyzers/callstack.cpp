@@ -15,14 +15,15 @@ CallStack::~CallStack()
 
 void CallStack::OnExecuteTrace( ExecuteTraceEvent &event )
 {
-    if (m_stack.empty()) {
+    if (m_context == CallContextTree::Root) {
         OnProcBegin(event);
     }
 }
 
 void CallStack::Reset()
 {
-    m_stack.clear();
+    // the interned contexts are kept, the access log refers to them
+    m_context = CallContextTree::Root;
     //m_prev = NULL;
 }
 
@@ -30,14 +31,13 @@ void CallStack::OnProcBegin( ExecuteTraceEvent &event )
 {
     Procedure *p;
     if ((p = m_procs->Get(event.Context->Eip)) != NULL) {
-        m_stack.push_back(p);
+        m_context = m_contexts.Push(m_context, p);
     }
 }
 
 void CallStack::OnProcEnd( ExecuteTraceEvent &event )
 {
-    Assert(!m_stack.empty());
-    m_stack.pop_back();
+    m_context = m_contexts.Pop(m_context);
 }
 
 void CallStack::OnComplete()
@@ -45,11 +45,37 @@ void CallStack::OnComplete()
     Reset();
 }
 
-u32 GetProcStackHash( const ProcStack &stack )
+CallContextTree::CallContextTree()
 {
-    u32 hash = 0;
-    for (auto &t : stack) {
-        hash = hash * 13131 + (*t).Entry();
-    }
-    return hash;
+    Reset();
+}
+
+void CallContextTree::Reset()
+{
+    m_nodes.clear();
+    m_children.clear();
+    Node root = { NULL, Root, 0, 0 };
+    m_nodes.push_back(root);
+}
+
+CallContextId CallContextTree::Push( CallContextId ctx, Procedure *proc )
+{
+    u64 key = ((u64) ctx << 32) | proc->Entry();
+    auto iter = m_children.find(key);
+    if (iter != m_children.end())
+        return iter->second;
+
+    const Node &parent = m_nodes[ctx];
+    Node node = { proc, ctx, parent.Depth + 1, parent.Hash * 13131 + proc->Entry() };
+    CallContextId id = (CallContextId) m_nodes.size();
+    m_nodes.push_back(node);
+    m_children[key] = id;
+    return id;
+}
+
+void CallContextTree::GetStack( CallContextId ctx, ProcStack &stack ) const
+{
+    stack.resize(m_nodes[ctx].Depth);
+    for (; ctx != Root; ctx = m_nodes[ctx].Parent)
+        stack[m_nodes[ctx].Depth - 1] = m_nodes[ctx].Proc;
 }
@@ -8,7 +8,41 @@
 
 typedef std::vector<Procedure *> ProcStack;
 
-u32 GetProcStackHash(const ProcStack &stack);
+/*
+ * Index of a node in a CallContextTree, 0 being the empty stack
+ */
+typedef u32 CallContextId;
+
+/*
+ * Calling-context tree: each distinct procedure stack seen is interned once as
+ * a node, so a stack is kept as a single id, pushing and popping just move to a
+ * child or to the parent, and two stacks of the same tree are equal iff their
+ * ids are
+ */
+class CallContextTree {
+public:
+    static const CallContextId  Root = 0;
+
+    struct Node {
+        Procedure *     Proc;
+        CallContextId   Parent;
+        int             Depth;
+        u32             Hash;       // the hash of the stack, for the dumps
+    };
+
+    CallContextTree();
+
+    CallContextId   Push(CallContextId ctx, Procedure *proc);
+    CallContextId   Pop(CallContextId ctx) const { Assert(ctx != Root); return m_nodes[ctx].Parent; }
+    const Node &    Get(CallContextId ctx) const { return m_nodes[ctx]; }
+    int             Count() const { return (int) m_nodes.size(); }
+    void            GetStack(CallContextId ctx, ProcStack &stack) const;
+    void            Reset();
+
+private:
+    std::vector<Node>   m_nodes;
+    std::unordered_map<u64, CallContextId>  m_children;     // (parent, entry) -> child
+};
 
 class CallStack : public TraceAnalyzer {
 public:
@@ -21,14 +55,19 @@ public:
     virtual void OnProcEnd(ExecuteTraceEvent &event) override;
     virtual void OnComplete() override;
 
-    ProcStack &Get() { return m_stack; }
-    const ProcStack &Get() const { return m_stack; }
-    Procedure * Top() { return m_stack.back(); }
-    const Procedure * Top() const { return m_stack.back(); }
+    /*
+     * Ids stay valid after the replay, until the CallStack is destroyed
+     */
+    CallContextId   GetContext() const { return m_context; }
+    const CallContextTree & GetContexts() const { return m_contexts; }
+    int         Depth() const { return m_contexts.Get(m_context).Depth; }
+    Procedure * Top() { return m_contexts.Get(m_context).Proc; }
+    const Procedure * Top() const { return m_contexts.Get(m_context).Proc; }
 
 private:
     ProcScope * m_procs;
-    ProcStack   m_stack;
+    CallContextTree m_contexts;
+    CallContextId   m_context;
     // const TContext *m_prev;
 };
  
@@ -8,6 +8,7 @@ MessageAccessLog::MessageAccessLog( const Message *msg )
 {
     m_callstack = NULL;
     m_currmsg = msg;
+    m_hasHeld = false;
 }
 
 MessageAccessLog::~MessageAccessLog()
@@ -17,10 +18,7 @@ MessageAccessLog::~MessageAccessLog()
 
 void MessageAccessLog::Reset()
 {
-    for (auto &t : m_accesses) {
-        SAFE_DELETE(t);
-    }
-    m_accesses.clear();
+    m_hasHeld = false;
 }
 
 void MessageAccessLog::OnExecuteTrace( ExecuteTraceEvent &event )
@@ -40,16 +38,17 @@ void MessageAccessLog::OnExecuteTrace( ExecuteTraceEvent &event )
 
 void MessageAccessLog::OnComplete()
 {
-#if FIX_ADJACENT_REVERSE_ORDER
-    StackHashComparator cmp;
-    for (uint i = 0; i < m_accesses.size() - 1; i++) {
-        if (m_accesses[i]->Offset == m_accesses[i+1]->Offset + 1 && 
-            cmp.Equals(m_accesses[i], m_accesses[i+1])) 
-        {
-            std::swap(m_accesses[i], m_accesses[i+1]);
-        }
-    }
-#endif
+    if (m_hasHeld)
+        Emit(m_held);
+    m_hasHeld = false;
+    for (auto &h : m_handlers)
+        h->OnComplete();
+}
+
+void MessageAccessLog::Emit( const MessageAccess &acc )
+{
+    for (auto &h : m_handlers)
+        h->OnAccess(acc);
 }
 
 void MessageAccessLog::OnMemRead( const TContext *t, u32 addr, byte data )
@@ -60,24 +59,45 @@ void MessageAccessLog::OnMemRead( const TContext *t, u32 addr, byte data )
     if (data != m_currmsg->Get(offset)) {
         return;
     }
-    MessageAccess *acc = new MessageAccess;
-    acc->CallStack = m_callstack->Get();
-    acc->Context = t;
-    acc->Offset = offset;
-    m_accesses.push_back(acc);
+    MessageAccess acc;
+    acc.CallContext = m_callstack->GetContext();
+    acc.Context = t;
+    acc.Offset = offset;
+
+#if FIX_ADJACENT_REVERSE_ORDER
+    if (!m_hasHeld) {
+        m_held = acc;
+        m_hasHeld = true;
+        return;
+    }
+    // the byte before the held one, read from the same context, goes first;
+    // the held access is carried on and compared with the next one
+    StackHashComparator cmp;
+    if (m_held.Offset == acc.Offset + 1 && cmp.Equals(&m_held, &acc)) {
+        Emit(acc);
+        return;
+    }
+    Emit(m_held);
+    m_held = acc;
+#else
+    Emit(acc);
+#endif
 }
 
-void MessageAccessLog::Dump( File &f ) const
+MessageAccessDumper::MessageAccessDumper( const Message *msg, const CallStack *cs, File &f )
+    : m_msg(msg), m_callstack(cs), m_file(f)
 {
-    for (auto &m : m_accesses) {
-        byte c = m_currmsg->Get(m->Offset);
-        fprintf(f.Ptr(), "%3d '%c' %08x %-50s  stack_hash=%08x", 
-            m->Offset, isprint(c) ? c : '.', m->Context->Eip, 
-            m->Context->Inst->Main.CompleteInstr, GetProcStackHash(m->CallStack));
-        fprintf(f.Ptr(), "  %08x", m->CallStack[0]->Entry());
-        for (uint i = 1; i < m->CallStack.size(); i++)
-            fprintf(f.Ptr(), "->%08x", m->CallStack[i]->Entry());
-        fprintf(f.Ptr(), "\n");
-    }
-    
+}
+
+void MessageAccessDumper::OnAccess( const MessageAccess &acc )
+{
+    const CallContextTree &contexts = m_callstack->GetContexts();
+    byte c = m_msg->Get(acc.Offset);
+    contexts.GetStack(acc.CallContext, m_stack);
+    fprintf(m_file.Ptr(), "%3d '%c' %08x %-50s  stack_hash=%08x", 
+        acc.Offset, isprint(c) ? c : '.', acc.Context->Eip, 
+        acc.Context->Inst->Main.CompleteInstr, contexts.Get(acc.CallContext).Hash);
+    for (uint i = 0; i < m_stack.size(); i++)
+        fprintf(m_file.Ptr(), i == 0 ? "  %08x" : "->%08x", m_stack[i]->Entry());
+    fprintf(m_file.Ptr(), "\n");
 }
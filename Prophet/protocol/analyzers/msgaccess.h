@@ -10,9 +10,24 @@
 struct MessageAccess {
     int Offset;
     const TContext *Context;
-    ProcStack CallStack;
+    CallContextId CallContext;      // interned by the CallStack of the log
 };
 
+/*
+ * Receives the accesses of a MessageAccessLog as they are replayed, in log order
+ */
+class MessageAccessHandler {
+public:
+    virtual ~MessageAccessHandler() {}
+    virtual void OnAccess(const MessageAccess &acc) = 0;
+    virtual void OnComplete() {}
+};
+
+/*
+ * Reads of the message bytes during the replay, passed on to the handlers
+ * rather than kept; only one access is held back, to fix the order of
+ * adjacent reads
+ */
 class MessageAccessLog : public TraceAnalyzer {
 public:
     MessageAccessLog(const Message *msg);
@@ -21,22 +36,38 @@ public:
     void Reset() override;
     void OnExecuteTrace(ExecuteTraceEvent &event) override;
     void OnComplete() override;
-    void Dump(File &f) const;
 
     void SetCallStack(CallStack *cs) { m_callstack = cs; }
+    void Add(MessageAccessHandler *h) { m_handlers.push_back(h); }
 
-    int Count() const { return m_accesses.size(); }
-    const MessageAccess *Get(int n) const { Assert(n >= 0 && n < Count()); return m_accesses[n]; }
     const Message *GetMessage() const { return m_currmsg; }
 
 private:
     void OnMemRead(const TContext *t, u32 addr, byte data);
+    void Emit(const MessageAccess &acc);
 private:
     CallStack *     m_callstack;
     const Message * m_currmsg;
-    std::vector<MessageAccess *>    m_accesses;
+    std::vector<MessageAccessHandler *> m_handlers;
+    MessageAccess   m_held;
+    bool            m_hasHeld;
 };
 
+/*
+ * Writes the accesses out as text, one per line
+ */
+class MessageAccessDumper : public MessageAccessHandler {
+public:
+    MessageAccessDumper(const Message *msg, const CallStack *cs, File &f);
+
+    void OnAccess(const MessageAccess &acc) override;
+
+private:
+    const Message *     m_msg;
+    const CallStack *   m_callstack;
+    File &              m_file;
+    ProcStack           m_stack;
+};
 
  
 #endif // __PROPHET_PROTOCOL_ANALYZERS_MSGACCESS_H__
\ No newline at end of file
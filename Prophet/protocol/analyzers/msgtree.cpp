@@ -1,11 +1,79 @@
 #include "stdafx.h"
 #include "msgtree.h"
+#include "protocol/taint/taintbits.h"
 
 
 bool StackHashComparator::Equals( const MessageAccess *l, const MessageAccess *r )
 {
     Assert(l && r);
-    return GetProcStackHash(l->CallStack) == GetProcStackHash(r->CallStack);
+    return l->CallContext == r->CallContext;
+}
+
+void ExecHistory::Grow( uint words )
+{
+    if (words > m_words.size())
+        m_words.resize((words + 7) & ~7, 0);
+}
+
+void ExecHistory::Insert( u32 id )
+{
+    Grow(id / 32 + 1);
+    m_words[id / 32] |= 1 << (id % 32);
+}
+
+int ExecHistory::Count() const
+{
+    return m_words.empty() ? 0 : g_taintBits.Count(&m_words[0], (int) m_words.size());
+}
+
+int ExecHistory::Next( int from ) const
+{
+    for (uint i = from / 32; i < m_words.size(); i++) {
+        u32 word = m_words[i];
+        if (i == from / 32) word &= 0xffffffff << (from % 32);
+        if (word != 0) {
+            unsigned long bit;
+            _BitScanForward(&bit, word);
+            return i * 32 + bit;
+        }
+    }
+    return -1;
+}
+
+bool ExecHistory::operator==( const ExecHistory &h ) const
+{
+    const ExecHistory &shorter = m_words.size() < h.m_words.size() ? *this : h;
+    const ExecHistory &longer = &shorter == this ? h : *this;
+    int n = (int) shorter.m_words.size();
+    int extra = (int) longer.m_words.size() - n;
+    if (n > 0 && !g_taintBits.Equal(&shorter.m_words[0], &longer.m_words[0], n))
+        return false;
+    return extra == 0 || g_taintBits.IsZero(&longer.m_words[n], extra);
+}
+
+ExecHistory & ExecHistory::operator|=( const ExecHistory &h )
+{
+    Grow(h.m_words.size());
+    if (!h.m_words.empty())
+        g_taintBits.Or(&m_words[0], &h.m_words[0], (int) h.m_words.size());
+    return *this;
+}
+
+ExecHistory & ExecHistory::operator&=( const ExecHistory &h )
+{
+    m_words.resize(min(m_words.size(), h.m_words.size()));
+    if (!m_words.empty())
+        g_taintBits.And(&m_words[0], &h.m_words[0], (int) m_words.size());
+    return *this;
+}
+
+double ExecHistory::Similarity( const ExecHistory &h ) const
+{
+    ExecHistory both = *this;
+    both &= h;
+    int common = both.Count();
+    int all = Count() + h.Count() - common;
+    return all == 0 ? 1.0 : (double) common / all;
 }
 
 
@@ -20,62 +88,79 @@ MsgTree::~MsgTree()
     SAFE_DELETE(m_root);
 }
 
-void MsgTree::Construct( const MessageAccessLog *log, MessageAccessComparator &cmp )
+MsgTreeBuilder::MsgTreeBuilder( MsgTree *tree, MessageAccessComparator &cmp )
+    : m_tree(tree), m_cmp(cmp)
 {
-#define MINIMUM_SEQUENCE_LENGTH 4
     LxDebug("Constructing message tree\n");
-    m_root = new TreeNode(0, m_message->Size() - 1);
+    int size = m_tree->m_message->Size();
+    m_tree->m_root = new TreeNode(0, size - 1);
+    m_currNode = NULL;
+    m_history.resize(size);
+    m_historyStrict.resize(size);
+}
 
-    const MessageAccess *prev = log->Get(0);
-    TreeNode *currNode = new TreeNode(prev->Offset, prev->Offset);
-    for (int i = 1; i < log->Count(); i++) {
-        const MessageAccess *curr = log->Get(i);
+MsgTreeBuilder::~MsgTreeBuilder()
+{
+    SAFE_DELETE(m_currNode);
+}
 
-        if (curr->Offset == prev->Offset && cmp.Equals(curr, prev)) {
-            // ignore local visits
-            continue;
-        }
+void MsgTreeBuilder::OnAccess( const MessageAccess &acc )
+{
+    m_history[acc.Offset].Insert(acc.CallContext);
+    m_historyStrict[acc.Offset].push_back(acc.CallContext);
 
-        if (curr->Offset == prev->Offset+1 && cmp.Equals(curr, prev)) {
-            currNode->m_r++;
-        } else {
+    if (m_currNode == NULL) {
+        m_currNode = new TreeNode(acc.Offset, acc.Offset);
+        m_prev = acc;
+        return;
+    }
 
-            if (currNode->Length() >= MINIMUM_SEQUENCE_LENGTH || currNode->Length() == 1) {
-#if 0
-                LxInfo("inserting [%d,%d]\n", currNode->m_l, currNode->m_r);
-                if (currNode->m_l == 0x46 && currNode->m_r == 0x50) {
-                    LxDebug("debug\n");
-                }
-#endif
-                Insert(currNode);
-                currNode = new TreeNode(curr->Offset, curr->Offset);
-            } else {
-                currNode->m_l = currNode->m_r = curr->Offset;
-            }
-#if 0
-            if (!CheckValidity()) {
-                LxFatal("MessageTree validity check failed\n");
-            }
-#endif
-        }
-        prev = curr;
+    if (acc.Offset == m_prev.Offset && m_cmp.Equals(&acc, &m_prev)) {
+        // ignore local visits
+        return;
     }
 
-    if (currNode->Length() >= MINIMUM_SEQUENCE_LENGTH || currNode->Length() == 1) {
-        Insert(currNode);
+    if (acc.Offset == m_prev.Offset+1 && m_cmp.Equals(&acc, &m_prev)) {
+        m_currNode->m_r++;
+    } else if (IsKept(m_currNode)) {
+        m_tree->Insert(m_currNode);
+        m_currNode = new TreeNode(acc.Offset, acc.Offset);
     } else {
-        delete currNode;
+        m_currNode->m_l = m_currNode->m_r = acc.Offset;
+    }
+    m_prev = acc;
+}
+
+void MsgTreeBuilder::OnComplete()
+{
+    if (m_currNode) {
+        if (IsKept(m_currNode))
+            m_tree->Insert(m_currNode);
+        else
+            delete m_currNode;
+        m_currNode = NULL;
     }
-    
 
 #ifdef _DEBUG
-    if (!CheckValidity()) {
+    if (!m_tree->CheckValidity()) {
         LxFatal("MessageTree validity check failed\n");
     }
 #endif
 
-    m_root->FixParent();
-#undef MINIMUM_SEQUENCE_LENGTH
+    m_tree->m_root->FixParent();
+    SetHistory(m_tree->m_root);
+}
+
+/*
+ * A node has the history of the reads of its first byte
+ */
+void MsgTreeBuilder::SetHistory( TreeNode *node )
+{
+    node->m_execHistory = m_history[node->m_l];
+    node->m_execHistoryStrict = m_historyStrict[node->m_l];
+    for (auto &c : node->m_children) {
+        SetHistory(c);
+    }
 }
 
 void MsgTree::Insert( TreeNode *node )
@@ -107,11 +192,6 @@ void MsgTree::DumpDot( File &f, bool isRoot ) const
     fprintf(f.Ptr(), "}\n");
 }
 
-void MsgTree::UpdateHistory( const MessageAccessLog *t )
-{
-    m_root->UpdateHistory(t);
-}
-
 TreeNode * MsgTree::FindOrCreateNode( const MemRegion &r )
 {
     return FindOrCreateNode(TaintRegion(r.Addr - m_message->GetRegion().Addr, r.Len));
@@ -427,7 +507,7 @@ void TreeNode::Dump( File &f, const Message *msg, int level ) const
     for (int i = 0; i < level; i++)
         fprintf(f.Ptr(), " ");
     fprintf(f.Ptr(), "[%d,%d] %s  EH:(", m_l, m_r, GetDotLabel(msg).c_str());
-    for (auto val : m_execHistory) {
+    for (int val = m_execHistory.Next(0); val != -1; val = m_execHistory.Next(val + 1)) {
         fprintf(f.Ptr(), "%08x ", val);
     }
     fprintf(f.Ptr(), "), SEH:(");
@@ -518,22 +598,6 @@ std::string TreeNode::GetDotLabel( const Message *msg ) const
         IsLeaf() ? 36 : 24);
 }
 
-void TreeNode::UpdateHistory( const MessageAccessLog *t )
-{
-    for (int i = 0; i < t->Count(); i++) {
-        const MessageAccess *ma = t->Get(i);
-        if (ma->Offset == m_l) {
-            u32 entry = GetProcStackHash(ma->CallStack);
-            m_execHistory.insert(entry);
-            m_execHistoryStrict.push_back(entry);
-        }
-    }
-
-    for (auto &c : m_children) {
-        c->UpdateHistory(t);
-    }
-}
-
 void TreeNode::AppendChild( TreeNode *node )
 {
     node->m_parent = this;
@@ -15,7 +15,33 @@ public:
     virtual bool Equals(const MessageAccess *l, const MessageAccess *r) override;
 };
 
-typedef std::set<u32>       ExecHistory;
+/*
+ * Set of calling contexts (CallContextId) a node was read from
+ * The ids are dense, so the set is a plain bitmap and comparing or combining
+ * two histories is word-wise work done by the taint bitmap kernels
+ */
+class ExecHistory {
+public:
+    void        Insert(u32 id);
+    bool        Contains(u32 id) const {
+        return id / 32 < m_words.size() && (m_words[id / 32] & (1 << (id % 32))) != 0;
+    }
+    void        Clear() { m_words.clear(); }
+    int         Count() const;
+    int         Next(int from) const;       // the lowest id >= from, or -1
+
+    bool        operator==(const ExecHistory &h) const;
+    bool        operator!=(const ExecHistory &h) const { return !(*this == h); }
+    ExecHistory &   operator|=(const ExecHistory &h);
+    ExecHistory &   operator&=(const ExecHistory &h);
+    double      Similarity(const ExecHistory &h) const;     // Jaccard index
+
+private:
+    void        Grow(uint words);
+private:
+    std::vector<u32>    m_words;    // a multiple of 8 words, for the kernels
+};
+
 typedef std::vector<u32>    ExecHistoryStrict;
 
 enum NodeFlag {
@@ -46,6 +72,7 @@ class TreeNode {
     friend class TokenizeRefiner;
     friend class ParallelFieldDetector;
     friend class SanitizeRefiner;
+    friend class MsgTreeBuilder;
 public:
     TreeNode(int l, int r, TreeNode *parent = NULL);
     virtual ~TreeNode();
@@ -64,7 +91,6 @@ public:
     std::string GetDotName(const Message *msg) const;
     std::string GetDotStyle(const Message *msg) const;
     std::string GetDotLabel(const Message *msg) const;
-    void    UpdateHistory(const MessageAccessLog *t);
     int     GetChildrenCount() const { return m_children.size(); }
     bool    HasFlag(NodeFlag f) const { return (m_flag & f) != 0; }
     //void    SetSubMessage(Message *msg) { Assert(!m_submsg); m_submsg = msg; }
@@ -95,14 +121,13 @@ private:
 
 class MsgTree {
     friend class MessageTreeRefiner;
+    friend class MsgTreeBuilder;
 public:
     MsgTree(Message *msg);
     virtual ~MsgTree();
 
-    void    Construct(const MessageAccessLog *log, MessageAccessComparator &cmp);
     void    Dump(File &f) const;
     void    DumpDot(File &f, bool isRoot) const;
-    void    UpdateHistory(const MessageAccessLog *t);
     TreeNode *   FindOrCreateNode(const MemRegion &r);
     TreeNode *   FindOrCreateNode(const TaintRegion &tr);
     TreeNode *   GetRoot() { return m_root; }
@@ -121,6 +146,37 @@ private:
     //const MessageAccessLog &m_log;
 };
 
+/*
+ * Builds the tree of a message while its accesses are replayed: a run of reads
+ * of consecutive bytes from the same context becomes a node as soon as the run
+ * ends, and exec histories are gathered per offset, so the access log does not
+ * have to be kept. The tree is complete, with the histories of its nodes, after
+ * OnComplete
+ */
+class MsgTreeBuilder : public MessageAccessHandler {
+public:
+    MsgTreeBuilder(MsgTree *tree, MessageAccessComparator &cmp);
+    virtual ~MsgTreeBuilder();
+
+    void    OnAccess(const MessageAccess &acc) override;
+    void    OnComplete() override;
+
+private:
+    static const int MinSequenceLength = 4;
+
+    bool    IsKept(const TreeNode *node) const {
+        return node->Length() >= MinSequenceLength || node->Length() == 1;
+    }
+    void    SetHistory(TreeNode *node);
+private:
+    MsgTree *   m_tree;
+    MessageAccessComparator &   m_cmp;
+    MessageAccess   m_prev;
+    TreeNode *      m_currNode;     // the current run, NULL before the first access
+    std::vector<ExecHistory>        m_history;
+    std::vector<ExecHistoryStrict>  m_historyStrict;
+};
+
 class MessageTreeRefiner {
 public:
     MessageTreeRefiner();
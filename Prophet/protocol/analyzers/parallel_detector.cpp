@@ -18,8 +18,8 @@ void ParallelFieldDetector::RefineNode( TreeNode *node )
 
 void ParallelFieldDetector::Reset()
 {
-    m_parallelExecHist.clear();
-    m_separatorExecHist.clear();
+    m_parallelExecHist.Clear();
+    m_separatorExecHist.Clear();
     m_foundSeparator = false;
 }
 
@@ -130,7 +130,7 @@ void ProcExec::OnProcBegin( ExecuteTraceEvent &event )
 
 void ProcExec::OnProcEnd( ExecuteTraceEvent &event )
 {
-    Assert(m_callstack->Get().size() == m_contexts.size());
+    Assert(m_callstack->Depth() == (int) m_contexts.size());
     auto back = m_contexts.back();
     m_contexts.pop_back();
     back.EndSeq = event.Seq;
@@ -87,3 +87,52 @@ void TraceExec::RunMessage( const Message *msg )
 {
     RunPartial(msg->GetTraceBegin(), msg->GetTraceEnd());
 }
+
+TracePipeline::TracePipeline( const RunTrace &t )
+    : m_trace(t), m_passes(0)
+{
+}
+
+void TracePipeline::Add( TraceAnalyzer *t )
+{
+    AddStage(t, 0);
+}
+
+void TracePipeline::Add( TraceAnalyzer *t, TraceAnalyzer *dep, Dependency kind )
+{
+    AddStage(t, PassAfter(dep, kind));
+}
+
+void TracePipeline::Add( TraceAnalyzer *t, TraceAnalyzer *dep0, TraceAnalyzer *dep1, 
+                         Dependency kind )
+{
+    AddStage(t, max(PassAfter(dep0, kind), PassAfter(dep1, kind)));
+}
+
+int TracePipeline::PassAfter( TraceAnalyzer *dep, Dependency kind ) const
+{
+    for (auto &s : m_stages) {
+        if (s.Analyzer == dep)
+            return kind == Complete ? s.Pass + 1 : s.Pass;
+    }
+    LxFatal("TracePipeline: dependency must be added first\n");
+    return 0;
+}
+
+void TracePipeline::AddStage( TraceAnalyzer *t, int pass )
+{
+    Stage s = { t, pass };
+    m_stages.push_back(s);
+    m_passes = max(m_passes, pass + 1);
+}
+
+void TracePipeline::RunMessage( const Message *msg )
+{
+    for (int pass = 0; pass < m_passes; pass++) {
+        TraceExec exec(m_trace);
+        for (auto &s : m_stages) {
+            if (s.Pass == pass) exec.Add(s.Analyzer);
+        }
+        exec.RunMessage(msg);
+    }
+}
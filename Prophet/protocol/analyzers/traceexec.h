@@ -32,4 +32,39 @@ private:
     const TContext *    m_prev;
 };
 
+/*
+ * Runs TraceAnalyzers over a message in as few replays as possible
+ * An analyzer is added after the ones it depends on. A Streaming dependency
+ * only has to see each trace first, so both share a replay; a Complete one
+ * must have finished (OnComplete), which puts the analyzer in a later replay.
+ * Within a replay analyzers run in the order they were added
+ */
+class TracePipeline {
+public:
+    enum Dependency {
+        Streaming,
+        Complete,
+    };
+
+public:
+    TracePipeline(const RunTrace &t);
+    void Add(TraceAnalyzer *t);
+    void Add(TraceAnalyzer *t, TraceAnalyzer *dep, Dependency kind = Streaming);
+    void Add(TraceAnalyzer *t, TraceAnalyzer *dep0, TraceAnalyzer *dep1, Dependency kind = Streaming);
+    int  PassCount() const { return m_passes; }
+    void RunMessage(const Message *msg);
+
+private:
+    int  PassAfter(TraceAnalyzer *dep, Dependency kind) const;
+    void AddStage(TraceAnalyzer *t, int pass);
+private:
+    struct Stage {
+        TraceAnalyzer * Analyzer;
+        int             Pass;
+    };
+    const RunTrace &    m_trace;
+    std::vector<Stage>  m_stages;
+    int                 m_passes;
+};
+
 #endif // __PROPHET_PROTOCOL_ANALYZERS_TRACEEXEC_H__
\ No newline at end of file
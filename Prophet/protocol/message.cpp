@@ -2,6 +2,7 @@
 #include "message.h"
 #include "engine.h"
 #include "cryptohelp.h"
+#include "tracefile.h"
 
 #include "analyzers/procscope.h"
 #include "analyzers/traceexec.h"
@@ -47,7 +48,6 @@ Message::Message(const MemRegion &r, cpbyte data, Message *parent,
 Message::~Message()
 {
     SAFE_DELETE_ARRAY(m_data);
-    SAFE_DELETE(m_accesslog);
     SAFE_DELETE(m_fieldTree);
     SAFE_DELETE(m_tag);
     for (auto &submsg : m_children) {
@@ -60,74 +60,88 @@ void Message::Analyze( MessageManager *msgmgr, const RunTrace &trace )
 {
     std::string name = GetName();
     LxInfo("Analyzing message %s ...\n", name.c_str());
-    TraceExec traceExe(trace);
     ProcScope procScope;
 
     std::string dir = g_engine.GetArchiveDir() + g_engine.GetArchiveFileName() + "\\";
     LxCreateDirectory(dir.c_str());
-    trace.DumpMsg(this, File(dir + "trace_" + GetName() + ".txt", "w"));
+    TraceWriter(dir + "trace_" + GetName() + ".ptr").Write(trace, m_traceBegin, m_traceEnd);
 
-    // Get Procedures
-    traceExe.Add(&procScope);
-    traceExe.RunMessage(this);
+    // an engine of its own, messages are analyzed concurrently
+    TaintEngine taintEngine;
+    TaintEngine *taint = &taintEngine;
+    taint->TaintRule_LoadMemory();
+    taint->TaintMemRegion(m_region);
 
+    // One replay for all: CallStack only looks up a procedure when it is entered,
+    // which ProcScope has just done for the same trace
     CallStack callStack(&procScope);
-    m_accesslog = new MessageAccessLog(this);
-    m_accesslog->SetCallStack(&callStack);
-    traceExe.Add(&callStack, m_accesslog);
-    traceExe.RunMessage(this);
-
-    m_accesslog->Dump(File(dir + "message_access_" + GetName() + ".txt", "w"));
+    MessageAccessLog accesslog(this);
+    accesslog.SetCallStack(&callStack);
 
+    // the accesses are dumped and built into the tree as they are replayed
+    File accessDump(dir + "message_access_" + GetName() + ".txt", "w");
+    MessageAccessDumper dumper(this, &callStack, accessDump);
+    StackHashComparator cmp;
     m_fieldTree = new MsgTree(this);
-    m_fieldTree->Construct(m_accesslog, StackHashComparator());
-    m_fieldTree->UpdateHistory(m_accesslog);
+    MsgTreeBuilder treeBuilder(m_fieldTree, cmp);
+    accesslog.Add(&dumper);
+    accesslog.Add(&treeBuilder);
+
+    AdvAlgEngine alg(msgmgr, this, 32);
+    ProcExec procExe(&callStack, taint);
+    procExe.Add(&alg);
+
+    TracePipeline pipeline(trace);
+    pipeline.Add(&procScope);
+    pipeline.Add(taint);
+    pipeline.Add(&callStack, &procScope);
+    pipeline.Add(&accesslog, &callStack);
+    pipeline.Add(&procExe, taint, &callStack);
+    pipeline.RunMessage(this);
 
+    // the refiners compare exec histories, which are only final once the
+    // replay is over
     //SanitizeRefiner().RefineTree(*m_fieldTree);
     TokenizeRefiner(this, m_type, 1).RefineTree(*m_fieldTree);
     ParallelFieldDetector(3).RefineTree(*m_fieldTree);
 
-    TaintEngine *taint = msgmgr->GetTaint();
-    taint->Reset();
-    taint->TaintRule_LoadMemory();
-    taint->TaintMemRegion(m_region);
-    AdvAlgEngine alg(msgmgr, this, 32);
-    ProcExec procExe(&callStack, taint);
-    procExe.Add(&alg);
-    traceExe.Add(taint, &callStack, &procExe);
-    traceExe.RunMessage(this);
-
-    if (m_parent != NULL) {
-        MemRegion parentData;
-        if (m_parent->SearchData(m_data, m_region.Len, parentData)) {
-            TreeNode *node = m_parent->GetTree()->FindOrCreateNode(parentData);
-            if (node) {
-                node->AddLink(NodeLink(
-                    m_fieldTree->GetRoot(), this, m_tag ? m_tag->AlgName.c_str() : "", "both"
-                    ));
-                LxInfo("link added %08x-%d\n", parentData.Addr, parentData.Len);
-            }
+    LxInfo("Message %s analysis complete\n", name.c_str());
+}
+
+/*
+ * Links the tree of a sub-message into the tree of its parent; the parent's
+ * tree is shared by all its children, so this runs after their analysis, in order
+ */
+void Message::LinkToParent()
+{
+    if (m_parent == NULL) return;
+    MemRegion parentData;
+    if (m_parent->SearchData(m_data, m_region.Len, parentData)) {
+        TreeNode *node = m_parent->GetTree()->FindOrCreateNode(parentData);
+        if (node) {
+            node->AddLink(NodeLink(
+                m_fieldTree->GetRoot(), this, m_tag ? m_tag->AlgName.c_str() : "", "both"
+                ));
+            LxInfo("link added %08x-%d\n", parentData.Addr, parentData.Len);
         }
     }
-    LxInfo("Message %s analysis complete\n", name.c_str());
 }
 
-void Message::AnalyzeAll( MessageManager *msgmgr, const RunTrace &trace )
+void Message::PostAnalyze( const RunTrace &trace )
 {
-    TraceExec traceExe(trace);
-    TaintEngine *taint = msgmgr->GetTaint();
+    // a replay of its own: it needs the refined tree, with the links of the
+    // children, and another set of taint rules
+    TaintEngine taintEngine;
+    TaintEngine *taint = &taintEngine;
 
-    taint->Reset();
     taint->TaintRule_LoadDefault();
     taint->TaintMemRegion(m_region);
     DirectionField df(this, taint);
-    traceExe.Add(taint, &df);
-    traceExe.RunMessage(this);
+    TracePipeline pipeline(trace);
+    pipeline.Add(taint);
+    pipeline.Add(&df, taint);
+    pipeline.RunMessage(this);
     LxInfo("Post-analyzing Message %s complate\n", GetName().c_str());
-
-    for (auto &msg : m_children) {
-        msg->AnalyzeAll(msgmgr, trace);
-    }
 }
 
 void Message::SetTraceRange( int beginIncl, int endIncl )
@@ -83,8 +83,11 @@ public:
     void        DumpTree(File &f) const;
     bool        SearchData(cpbyte p, int len, MemRegion &r);
 
+    const std::vector<Message *> &  GetChildren() const { return m_children; }
+
     void        Analyze(MessageManager *msgmgr, const RunTrace &trace);
-    void        AnalyzeAll(MessageManager *msgmgr, const RunTrace &trace);
+    void        LinkToParent();
+    void        PostAnalyze(const RunTrace &trace);
     void        Insert(Message *msg);
     MessageType GetType() const { return m_type; }
     std::string GetTypeString() const;
@@ -99,7 +102,6 @@ private:
     MemRegion       m_parentRegion;
     std::vector<Message *>  m_children;
     std::string     m_name;
-    MessageAccessLog *m_accesslog;
     MsgTree     *m_fieldTree;
     AlgTag *        m_tag;
     bool    m_clearNode;
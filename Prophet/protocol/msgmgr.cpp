@@ -15,21 +15,31 @@ MessageManager::MessageManager( Protocol *protocol )
     m_autoShowMemory    = true;
     m_tracing           = false;
     m_currId = 0;
-    m_taint = new TaintEngine();
     m_clearSubNodes = true;
+    m_asyncAnalysis = true;
+    m_maxPending    = 4;
+    m_analysisThread = NULL;
+    m_analysisThreads = 0;
+    m_pool = NULL;
 }
 
 MessageManager::~MessageManager()
 {
     //SAFE_DELETE(m_currRootMsg);
     Assert(m_currRootMsg == NULL);
-    //Analyze();
+    if (m_analysisThread) {
+        AnalysisJob stop = { NULL, NULL };
+        Submit(stop);
+        WaitForSingleObject(m_analysisThread, INFINITE);
+        CloseHandle(m_analysisThread);
+        m_analysisThread = NULL;
+    }
     Assert(m_msgQueue.empty());
     for (auto &msg : m_messages) {
         SAFE_DELETE(msg);
     }
     m_messages.clear();
-    SAFE_DELETE(m_taint);
+    SAFE_DELETE(m_pool);
 }
 
 void MessageManager::Initialize()
@@ -40,10 +50,6 @@ void MessageManager::Initialize()
 
 void MessageManager::OnMessageBegin( MessageBeginEvent &event )
 {
-    if (event.MessageLen >= Taint::GetWidth()) {
-        LxError("Prophet: message length(%d) >= taint width(%d)!\n", event.MessageLen,
-            Taint::GetWidth());
-    }
     //m_taint->TaintMemoryRanged(event.MessageAddr, event.MessageLen, false);
     m_currRootMsg = new Message(MemRegion(event.MessageAddr, event.MessageLen), event.MessageData);
     //m_format.OnMessageBegin(event);
@@ -68,13 +74,18 @@ void MessageManager::OnMessageEnd( MessageEndEvent &event )
     //m_format.OnMessageEnd(event);
 
     int nTraces = m_tracer.Count();
-    EnqueueMessage(m_currRootMsg, 0, nTraces-1);
-
-    Analyze();
-
+    AnalysisJob job = { m_currRootMsg, m_tracer.Detach() };
     m_currRootMsg = NULL;
-    m_tracer.End();
     m_tracing = false;
+
+    if (m_asyncAnalysis) {
+        if (m_analysisThread == NULL)
+            StartAnalysis();
+        m_freeSlots.Wait();     // back-pressure, at most m_maxPending messages in flight
+        Submit(job);
+    } else {
+        AnalyzeJobs(std::vector<AnalysisJob>(1, job));
+    }
     LxInfo("Finished %d run-traces\n", nTraces);
 
     if (m_breakOnMsgEnd) {
@@ -91,6 +102,9 @@ void MessageManager::Serialize( Json::Value &root ) const
     root["break_on_message_end"]    = m_breakOnMsgEnd;
     root["auto_show_memory"]        = m_autoShowMemory;
     root["clear_sub_nodes"]         = m_clearSubNodes;
+    root["async_analysis"]          = m_asyncAnalysis;
+    root["max_pending_messages"]    = m_maxPending;
+    root["analysis_threads"]        = m_analysisThreads;
 
 //     Json::Value formatsyn;
 //     m_format.Serialize(formatsyn);
@@ -107,6 +121,9 @@ void MessageManager::Deserialize( Json::Value &root )
     m_breakOnMsgEnd     = root.get("break_on_message_end", m_breakOnMsgEnd).asBool();
     m_autoShowMemory    = root.get("auto_show_memory", m_autoShowMemory).asBool();
     m_clearSubNodes = root.get("clear_sub_nodes", m_clearSubNodes).asBool();
+    m_asyncAnalysis = root.get("async_analysis", m_asyncAnalysis).asBool();
+    m_maxPending    = max(1, root.get("max_pending_messages", m_maxPending).asInt());
+    m_analysisThreads = root.get("analysis_threads", m_analysisThreads).asInt();
 
 //     Json::Value formatsyn = root["format_synthesizer"];
 //     if (!formatsyn.isNull())
@@ -123,48 +140,229 @@ void MessageManager::OnPostExecute( PostExecuteEvent &event )
         m_tracer.Trace(event.Cpu);
 }
 
+/*
+ * Called from the analysis tasks of the parents as well
+ */
 void MessageManager::EnqueueMessage( Message *msg, int beginIncl, int endIncl )
 {
     msg->SetTraceRange(beginIncl, endIncl);
+    MutexCSLock lock(m_queueLock);
     msg->SetID(msg->GetParent() ? msg->GetParent()->GetID() : m_currId++);
     m_msgQueue.push_back(msg);
 }
 
-void MessageManager::Analyze()
+void MessageManager::StartAnalysis()
+{
+    m_freeSlots.Post(m_maxPending);
+    m_analysisThread = CreateThread(NULL, 0, AnalysisThread, (LPVOID) this, 0, NULL);
+    if (m_analysisThread == NULL) {
+        LxFatal("Cannot create message analysis thread\n");
+    }
+}
+
+DWORD __stdcall MessageManager::AnalysisThread( LPVOID param )
+{
+    ((MessageManager *) param)->RunJobs();
+    return 0;
+}
+
+void MessageManager::Submit( const AnalysisJob &job )
 {
-    while (!m_msgQueue.empty()) {
-        Message *msg = m_msgQueue.front();
-        m_msgQueue.pop_front();
+    {
+        MutexCSLock lock(m_jobLock);
+        m_jobs.push_back(job);
+    }
+    m_jobsReady.Post();
+}
 
-        if (msg->GetParent() != NULL) {
-            msg->GetParent()->Insert(msg);
-        } else {
-            m_messages.push_back(msg);
+MessageManager::AnalysisJob MessageManager::PopJob()
+{
+    MutexCSLock lock(m_jobLock);
+    AnalysisJob job = m_jobs.front();
+    m_jobs.pop_front();
+    return job;
+}
+
+/*
+ * Jobs are taken in submission order, so messages are numbered and published
+ * in the order they ended. Whatever is queued when the thread gets to it is
+ * analyzed together
+ */
+void MessageManager::RunJobs()
+{
+    bool stop = false;
+    while (!stop) {
+        m_jobsReady.Wait();
+        std::vector<AnalysisJob> batch(1, PopJob());
+        while (m_jobsReady.TryWait())
+            batch.push_back(PopJob());
+
+        if (batch.back().Root == NULL) {
+            stop = true;
+            batch.pop_back();
         }
-        
-        msg->Analyze(this, m_tracer);
+        if (batch.empty()) continue;
+
+        AnalyzeJobs(batch);
+        m_freeSlots.Post((int) batch.size());
     }
+}
+
+class AnalyzeTask : public TaskPool::Task {
+public:
+    AnalyzeTask(MessageManager *msgmgr, Message *msg, const RunTrace *trace)
+        : m_msgmgr(msgmgr), m_msg(msg), m_trace(trace) {}
+    void Run() override { m_msg->Analyze(m_msgmgr, *m_trace); }
+private:
+    MessageManager *    m_msgmgr;
+    Message *           m_msg;
+    const RunTrace *    m_trace;
+};
+
+class PostAnalyzeTask : public TaskPool::Task {
+public:
+    PostAnalyzeTask(Message *msg, const RunTrace *trace)
+        : m_msg(msg), m_trace(trace) {}
+    void Run() override { m_msg->PostAnalyze(*m_trace); }
+private:
+    Message *           m_msg;
+    const RunTrace *    m_trace;
+};
 
-    if (m_currRootMsg) {
-        m_currRootMsg->AnalyzeAll(this, m_tracer);
+template <class T>
+static void RunTasks(TaskPool *pool, std::vector<T> &tasks)
+{
+    std::vector<TaskPool::Task *> ptrs;
+    for (auto &t : tasks)
+        ptrs.push_back(&t);
+    if (!ptrs.empty())
+        pool->Run(&ptrs[0], (int) ptrs.size());
+}
+
+struct ParentOrder {
+    const std::map<const Message *, int> &Rank;
+
+    ParentOrder(const std::map<const Message *, int> &rank) : Rank(rank) {}
+    int Of(const Message *msg) const {
+        auto iter = Rank.find(msg->GetParent());
+        return iter == Rank.end() ? -1 : iter->second;
     }
-//     for (auto &msg : m_messages) {
-//         msg->AnalyzeAll(this, m_tracer);
-//     }
+    bool operator()(const Message *a, const Message *b) const {
+        return Of(a) < Of(b);
+    }
+};
+
+static void CollectMessages(Message *msg, std::vector<Message *> &msgs)
+{
+    msgs.push_back(msg);
+    for (auto &ch : msg->GetChildren())
+        CollectMessages(ch, msgs);
 }
 
-void MessageManager::GenerateOutput()
+void MessageManager::AnalyzeJobs( const std::vector<AnalysisJob> &jobs )
+{
+    if (m_pool == NULL) {
+        m_pool = new TaskPool(m_analysisThreads);
+        LxInfo("Analyzing messages with %d threads\n", m_pool->Threads());
+    }
+
+    std::map<const Message *, const RunTrace *> traces;
+    for (auto &job : jobs) {
+        EnqueueMessage(job.Root, 0, job.Trace->Count()-1);
+        traces[job.Root] = job.Trace;
+    }
+    Analyze(traces);
+
+    // the trees are complete with all the links, each message post-analyzes its own
+    std::vector<PostAnalyzeTask> tasks;
+    for (auto &job : jobs) {
+        std::vector<Message *> msgs;
+        CollectMessages(job.Root, msgs);
+        for (auto &msg : msgs)
+            tasks.push_back(PostAnalyzeTask(msg, job.Trace));
+    }
+    RunTasks(m_pool, tasks);
+
+    for (auto &job : jobs) {
+        job.Trace->End();
+        delete job.Trace;
+        Publish(job.Root);
+    }
+}
+
+/*
+ * Blocks until every submitted message is analyzed and published
+ */
+void MessageManager::WaitForAnalysis()
 {
-    Analyze();
+    if (m_analysisThread == NULL) return;
+    for (int i = 0; i < m_maxPending; i++)
+        m_freeSlots.Wait();
+    m_freeSlots.Post(m_maxPending);
+}
+
+/*
+ * Analyzes the queued messages and the sub-messages they turn up, a generation
+ * at a time: the messages of a generation run concurrently, everything touching
+ * a parent's tree (Insert, LinkToParent) runs between generations in queue order,
+ * so the result does not depend on the number of threads
+ */
+void MessageManager::Analyze( const std::map<const Message *, const RunTrace *> &traces )
+{
+    std::map<const Message *, int> parentRank;
+    while (true) {
+        std::vector<Message *> wave;
+        {
+            MutexCSLock lock(m_queueLock);
+            wave.assign(m_msgQueue.begin(), m_msgQueue.end());
+            m_msgQueue.clear();
+        }
+        if (wave.empty()) break;
+
+        // sub-messages arrive in whatever order their parents finished, put
+        // them back in the order of the parents; siblings keep theirs
+        std::stable_sort(wave.begin(), wave.end(), ParentOrder(parentRank));
+
+        std::vector<AnalyzeTask> tasks;
+        for (auto &msg : wave) {
+            if (msg->GetParent() != NULL) {
+                msg->GetParent()->Insert(msg);
+            }
+            const Message *root = msg;
+            while (root->GetParent()) root = root->GetParent();
+            tasks.push_back(AnalyzeTask(this, msg, traces.find(root)->second));
+        }
+        RunTasks(m_pool, tasks);
+
+        parentRank.clear();
+        for (int i = 0; i < (int) wave.size(); i++) {
+            wave[i]->LinkToParent();
+            parentRank[wave[i]] = i;
+        }
+    }
+}
+
+/*
+ * The tree of a root message is final once it and its sub-messages are post-analyzed
+ */
+void MessageManager::Publish( Message *root )
+{
+    {
+        MutexCSLock lock(m_msgLock);
+        m_messages.push_back(root);
+    }
 
     std::string dir = g_engine.GetArchiveDir() + g_engine.GetArchiveFileName() + "\\";
     LxCreateDirectory(dir.c_str());
-    // dump dots
-    for (auto &msg : m_messages) {
-        msg->DumpTree(File(dir + "tree_" + msg->GetName() + ".txt", "w"));
-        std::string dotfile = dir + "tree_" + msg->GetName() + ".dot";
-        msg->GetTree()->DumpDot(File(dotfile, "w"), true);
-        DotToImage(dotfile);
-    }
+    root->DumpTree(File(dir + "tree_" + root->GetName() + ".txt", "w"));
+    std::string dotfile = dir + "tree_" + root->GetName() + ".dot";
+    root->GetTree()->DumpDot(File(dotfile, "w"), true);
+    DotToImage(dotfile);
 }
 
+void MessageManager::GenerateOutput()
+{
+    WaitForAnalysis();
+    MutexCSLock lock(m_msgLock);
+    LxInfo("%d messages analyzed\n", m_messages.size());
+}
@@ -7,6 +7,7 @@
 #include "event.h"
 #include "taint/taint.h"
 #include "runtrace.h"
+#include "parallel.h"
 
 class MessageManager : ISerializable {
 public:
@@ -19,7 +20,7 @@ public:
     void            OnMessageEnd(MessageEndEvent &event);
 
     void            EnqueueMessage(Message *msg, int beginIncl, int endIncl);
-    void            Analyze();
+    void            WaitForAnalysis();
     void            GenerateOutput();
 
 //     Message *       GetCurrentMessage() { return m_currRootMsg; }
@@ -28,14 +29,30 @@ public:
     const RunTrace &GetRunTrace() const { return m_tracer; }
     Protocol *      GetProtocol() { return m_protocol; }
     const Protocol *GetProtocol() const { return m_protocol; }
-    TaintEngine *   GetTaint() { return m_taint; }
-    const TaintEngine *GetTaint() const { return m_taint; }
 
     void            Serialize(Json::Value &root) const override;
     void            Deserialize(Json::Value &root) override;
 
 private:
-    TaintEngine *   m_taint;
+    /*
+     * A finished message and the traces it owns, analyzed off the emulation
+     * thread. A job without Root stops the analysis thread
+     */
+    struct AnalysisJob {
+        Message *   Root;
+        RunTrace *  Trace;
+    };
+
+    static DWORD __stdcall  AnalysisThread(LPVOID param);
+    void            StartAnalysis();
+    void            Submit(const AnalysisJob &job);
+    AnalysisJob     PopJob();
+    void            RunJobs();
+    void            AnalyzeJobs(const std::vector<AnalysisJob> &jobs);
+    void            Analyze(const std::map<const Message *, const RunTrace *> &traces);
+    void            Publish(Message *root);
+
+private:
     Protocol *      m_protocol;
     Message *       m_currRootMsg;
     RunTrace        m_tracer;
@@ -45,6 +62,18 @@ private:
     int             m_currId;
     std::vector<Message *>  m_messages;
     std::deque<Message *>   m_msgQueue;
+    MutexCS         m_queueLock;        // guards m_msgQueue and m_currId
+
+    bool            m_asyncAnalysis;
+    int             m_maxPending;       // messages waiting for analysis before the emulation stalls
+    HANDLE          m_analysisThread;
+    MutexCS         m_jobLock;
+    std::deque<AnalysisJob> m_jobs;
+    Semaphore       m_jobsReady;
+    Semaphore       m_freeSlots;
+    MutexCS         m_msgLock;          // guards m_messages
+    int             m_analysisThreads;  // 0: one per processor
+    TaskPool *      m_pool;
 
     bool            m_breakOnMsgBegin;
     bool            m_breakOnMsgEnd;
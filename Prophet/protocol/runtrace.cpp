@@ -7,77 +7,118 @@
 RunTrace::RunTrace(Protocol *engine) : m_engine(engine)
 {
     m_count = 0;
-    m_maxTraces = 100000;
-    m_traces = NULL;
     m_mergeCallJmp = true;
 }
 
 RunTrace::~RunTrace()
 {
-    SAFE_DELETE_ARRAY(m_traces);
+    Release();
 }
 
 void RunTrace::Trace( const Processor *cpu )
 {
-    m_engine->UpdateTContext(cpu, m_traces + m_count);
+    if ((m_count >> SegmentBits) == (int) m_segments.size())
+        AddSegment();
+
+    TContext *ctx = Slot(m_count);
+    m_engine->UpdateTContext(cpu, ctx);
 
     if (m_mergeCallJmp && m_count > 0 &&
-        Instruction::IsIndirectJump(m_traces[m_count].Inst) &&
-        Instruction::IsCall(m_traces[m_count-1].Inst)
+        Instruction::IsIndirectJump(ctx->Inst) &&
+        Instruction::IsCall(Slot(m_count-1)->Inst)
         ) 
     {
         LxDebug("CALL-JMP ignored, [%08x] %s\n", 
-            m_traces[m_count].Eip, m_traces[m_count].Inst->Main.CompleteInstr);
-        m_traces[m_count-1].ExecFlag |= m_traces[m_count].ExecFlag; // merge exec flag
+            ctx->Eip, ctx->Inst->Main.CompleteInstr);
+        Slot(m_count-1)->ExecFlag |= ctx->ExecFlag; // merge exec flag
+        ZeroMemory(ctx, sizeof(TContext));          // the slot is taken by the next trace
         return;
     }
 
     m_count++;
 }
 
+void RunTrace::Append( const TContext &ctx )
+{
+    if ((m_count >> SegmentBits) == (int) m_segments.size())
+        AddSegment();
+    *Slot(m_count++) = ctx;
+}
+
 void RunTrace::Begin()
 {
-    LxInfo("Allocating %d traces for RunTracer, Memory used = %d KB\n", 
-        m_maxTraces, m_maxTraces * sizeof(TContext) / 1024);
-    Assert(m_traces == NULL);
-    m_traces = new TContext[m_maxTraces];
-    if (m_traces == NULL) {
-        LxFatal("Error allocating traces for RunTracer\n");
-    }
-    ZeroMemory(m_traces, sizeof(TContext) * m_maxTraces);
+    Assert(m_segments.empty());
     m_count = 0;
 }
 
 void RunTrace::End()
 {
-    Assert(m_traces != NULL);
-    SAFE_DELETE_ARRAY(m_traces);
+    LxInfo("RunTracer used %d segments, Memory used = %d KB\n", m_segments.size(),
+        m_segments.size() * SegmentSize * sizeof(TContext) / 1024);
+    Release();
+    m_count = 0;
+}
+
+/*
+ * Hands the traces recorded so far over to a new RunTrace, which owns them
+ * until it is deleted, and leaves this one empty for the next message
+ */
+RunTrace * RunTrace::Detach()
+{
+    RunTrace *trace = new RunTrace(m_engine);
+    trace->m_mergeCallJmp = m_mergeCallJmp;
+    trace->m_segments.swap(m_segments);
+    trace->m_count = m_count;
     m_count = 0;
+    return trace;
+}
+
+void RunTrace::AddSegment()
+{
+    // fresh pagefile-backed views read as zeros, which UpdateTContext relies on
+    Segment seg;
+    seg.Mapping = CreateFileMapping(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 
+        0, SegmentSize * sizeof(TContext), NULL);
+    if (NULL == seg.Mapping) {
+        LxFatal("Unable to create mapping for RunTracer\n");
+    }
+    seg.Data = (TContext *) MapViewOfFile(seg.Mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (NULL == seg.Data) {
+        LxFatal("Unable to map view of RunTracer segment %d\n", m_segments.size());
+    }
+    m_segments.push_back(seg);
+}
+
+void RunTrace::Release()
+{
+    for (auto &seg : m_segments) {
+        UnmapViewOfFile(seg.Data);
+        CloseHandle(seg.Mapping);
+    }
+    m_segments.clear();
 }
 
 void RunTrace::Serialize( Json::Value &root ) const 
 {
-    root["max_traces"] = m_maxTraces;
     root["merge_calljmp"] = m_mergeCallJmp;
 }
 
 void RunTrace::Deserialize( Json::Value &root )
 {
-    m_maxTraces = root.get("max_traces", m_maxTraces).asInt();
     m_mergeCallJmp = root.get("merge_calljmp", m_mergeCallJmp).asBool();
 }
 
 void RunTrace::Dump( File &f ) const
 {
     for (int i = 0; i < m_count; i++)
-        m_traces[i].Dump(f);
+        Get(i)->Dump(f);
 }
 
 void RunTrace::DumpMsg( Message *msg, File &f ) const
 {
     Assert(msg->GetTraceEnd() < m_count);
     for (int i = msg->GetTraceBegin(); i <= msg->GetTraceEnd(); i++)
-        m_traces[i].Dump(f);
+        Get(i)->Dump(f);
 }
 
 void TContext::Dump( File &f ) const
@@ -8,17 +8,34 @@
 #include "utilities.h"
 #include "tcontext.h"
 
+/*
+ * Append-only store of the traces of one message
+ * Traces are kept in fixed-size segments, each a view of its own pagefile-backed
+ * mapping, so nothing is allocated or zeroed up front and there is no limit
+ * on the count. Segments never move: appending is O(1) and a TContext pointer
+ * stays valid until End()
+ */
 class RunTrace : public MutexSyncObject, public ISerializable {
+    static const int    SegmentBits = 16;
+    static const int    SegmentSize = 1 << SegmentBits;
+
+    struct Segment {
+        HANDLE      Mapping;
+        TContext *  Data;
+    };
+
 public:
     RunTrace(Protocol *engine);
     ~RunTrace();
 
     void        Begin();
     void        Trace(const Processor *cpu);
+    void        Append(const TContext &ctx);
     void        End();
+    RunTrace *  Detach();
     int         Count() const { return m_count; }
-    TContext *  Get(int n) { Assert(n >= 0 && n < m_count); return m_traces + n; }
-    const TContext * Get(int n) const { Assert(n >= 0 && n < m_count); return m_traces + n; }
+    TContext *  Get(int n) { Assert(n >= 0 && n < m_count); return Slot(n); }
+    const TContext * Get(int n) const { Assert(n >= 0 && n < m_count); return Slot(n); }
 
     void        Serialize(Json::Value &root) const override;
     void        Deserialize(Json::Value &root) override;
@@ -26,11 +43,17 @@ public:
     void        Dump(File &f) const;
     void        DumpMsg(Message *msg, File &f) const;
 
+private:
+    TContext *  Slot(int n) const {
+        return m_segments[n >> SegmentBits].Data + (n & (SegmentSize - 1));
+    }
+    void        AddSegment();
+    void        Release();
+
 private:
     int         m_count;
-    int         m_maxTraces;
     Protocol *  m_engine;
-    TContext *  m_traces;
+    std::vector<Segment>    m_segments;
     bool        m_mergeCallJmp;
 };
  
@@ -2,117 +2,99 @@
 #include "comptaint.h"
 #include "utilities.h"
 
+const MemoryTaint::PageTaint MemoryTaint::CleanPage;
+
 MemoryTaint::MemoryTaint()
 {
-    //ZeroMemory(m_pagetable, sizeof(m_pagetable));
-    m_pagetable = new PageTaint *[Pages];
-    ZeroMemory(m_pagetable, sizeof(PageTaint *) * Pages);
+    ZeroMemory(m_tables, sizeof(m_tables));
 }
 
 MemoryTaint::~MemoryTaint()
 {
-    for (int i = 0; i < Pages; i++) {
-        SAFE_DELETE(m_pagetable[i]);
-    }
-    SAFE_DELETE_ARRAY(m_pagetable);
+    Reset();
 }
 
-MemoryTaint::PageTaint * MemoryTaint::GetPage( u32 addr )
+MemoryTaint::PageTaint::PageTaint( const PageTaint &t )
 {
-    const u32 pageNum = PAGE_NUM(addr);
-    if (m_pagetable[pageNum] == NULL) {
-        m_pagetable[pageNum] = new PageTaint;
-    }
-    return m_pagetable[pageNum];
+    Refs = 1;
+    for (int i = 0; i < LX_PAGE_SIZE; i++)
+        Data[i] = t.Data[i];
 }
 
-void MemoryTaint::Reset()
+void MemoryTaint::ReleasePage( PageTaint *page )
 {
-    for (int i = 0; i < Pages; i++) {
-        if (m_pagetable[i] != NULL)
-            m_pagetable[i]->Reset();
-    }
+    if (page && InterlockedDecrement(&page->Refs) == 0)
+        delete page;
 }
 
-MemoryTaint * MemoryTaint::Clone() const
+void MemoryTaint::ReleaseTable( PageTable *table )
 {
-    MemoryTaint *t = new MemoryTaint;
-    for (int i = 0; i < Pages; i++) {
-        if (m_pagetable[i]) t->m_pagetable[i] = m_pagetable[i]->Clone();
-    }
-    return t;
+    if (InterlockedDecrement(&table->Refs) != 0) return;
+    for (u32 i = 0; i < PagesPerTable; i++)
+        ReleasePage(table->Pages[i]);
+    delete table;
 }
 
-void MemoryTaint::CopyFrom( const MemoryTaint *t )
+MemoryTaint::PageTaint * MemoryTaint::GetWritablePage( u32 addr )
 {
-    for (int i = 0; i < Pages; i++) {
-        if (t->m_pagetable[i]) {
-            if (m_pagetable[i]) 
-                m_pagetable[i]->CopyFrom(t->m_pagetable[i]);
-            else
-                m_pagetable[i] = t->m_pagetable[i]->Clone();
-        } else {
-            SAFE_DELETE(m_pagetable[i]);
-        }
+    Assert((addr & 0x80000000) == 0);
+    PageTable *&table = m_tables[PAGE_NUM(addr) >> TableBits];
+    if (table == NULL) {
+        table = new PageTable;
+        ZeroMemory(table, sizeof(PageTable));
+        table->Refs = 1;
+    } else if (table->Refs > 1) {
+        // shared with a copy, take a private one
+        PageTable *copy = new PageTable(*table);
+        copy->Refs = 1;
+        for (u32 i = 0; i < PagesPerTable; i++)
+            if (copy->Pages[i]) InterlockedIncrement(&copy->Pages[i]->Refs);
+        ReleaseTable(table);
+        table = copy;
     }
-}
-
-
-Taint MemoryTaint::PageTaint::Get( u32 offset )
-{
-    Assert(offset < LX_PAGE_SIZE);
-
-    if (m_data[offset] == NULL)
-        m_data[offset] = new Taint;
 
-    return *m_data[offset];
-}
-
-void MemoryTaint::PageTaint::Set( u32 offset, const Taint &t )
-{
-    Assert(offset < LX_PAGE_SIZE);
-
-    if (m_data[offset] == 0)
-        m_data[offset] = new Taint(t);
-    else
-        *(m_data[offset]) = t;
-}
-
-void MemoryTaint::PageTaint::Reset()
-{
-    for (int i = 0; i < LX_PAGE_SIZE; i++)
-        if (m_data[i]) SAFE_DELETE(m_data[i]);
+    PageTaint *&page = table->Pages[PAGE_NUM(addr) & (PagesPerTable - 1)];
+    if (page == NULL) {
+        page = new PageTaint;
+    } else if (page->Refs > 1) {
+        PageTaint *copy = new PageTaint(*page);
+        ReleasePage(page);
+        page = copy;
+    }
+    return page;
 }
 
-MemoryTaint::PageTaint::PageTaint()
+void MemoryTaint::SetByte( u32 addr, const Taint &t )
 {
-    uint x = sizeof(m_data);
-    ZeroMemory(m_data, sizeof(m_data));
+    if (GetPage(addr) == &CleanPage && !t.IsAnyTainted()) return;
+    GetWritablePage(addr)->Data[PAGE_LOW(addr)] = t;
 }
 
-MemoryTaint::PageTaint::~PageTaint()
+void MemoryTaint::Reset()
 {
-    Reset();
+    for (u32 i = 0; i < Tables; i++) {
+        if (m_tables[i] == NULL) continue;
+        ReleaseTable(m_tables[i]);
+        m_tables[i] = NULL;
+    }
 }
 
-MemoryTaint::PageTaint * MemoryTaint::PageTaint::Clone() const
+MemoryTaint * MemoryTaint::Clone() const
 {
-    PageTaint *t = new PageTaint;
-    for (int i = 0; i < LX_PAGE_SIZE; i++) {
-        if (m_data[i]) t->m_data[i] = new Taint(*m_data[i]);
-    }
+    MemoryTaint *t = new MemoryTaint;
+    t->CopyFrom(this);
     return t;
 }
 
-void MemoryTaint::PageTaint::CopyFrom( const PageTaint *t )
+void MemoryTaint::CopyFrom( const MemoryTaint *t )
 {
-    for (int i = 0; i < LX_PAGE_SIZE; i++) {
-        if (t->m_data[i]) {
-            if (m_data[i]) *(m_data[i]) = *(t->m_data[i]);
-            else m_data[i] = new Taint(*t->m_data[i]);
-        } else {
-            SAFE_DELETE(m_data[i]);
-        }
+    // share the tables, pages are duplicated lazily by GetWritablePage
+    for (u32 i = 0; i < Tables; i++) {
+        PageTable *table = t->m_tables[i];
+        if (table == m_tables[i]) continue;
+        if (table) InterlockedIncrement(&table->Refs);
+        if (m_tables[i]) ReleaseTable(m_tables[i]);
+        m_tables[i] = table;
     }
 }
 
@@ -130,14 +112,12 @@ void ProcessorTaint::Reset()
 
 ProcessorTaint * ProcessorTaint::Clone() const
 {
-    ProcessorTaint *t = new ProcessorTaint;
-    memcpy(t, this, sizeof(ProcessorTaint));
-    return t;
+    return new ProcessorTaint(*this);
 }
 
 void ProcessorTaint::CopyFrom( const ProcessorTaint *t )
 {
-    memcpy(this, t, sizeof(ProcessorTaint));
+    *this = *t;     // Taint owns its bitmap, no memcpy
 }
 
 
@@ -171,30 +151,20 @@ void ProcessorTaint::Dump( File &f ) const
 void MemoryTaint::Dump( File &f ) const
 {
     fprintf(f.Ptr(), "Memory Taint:\n");
-    for (u32 i = 0; i < LX_PAGE_COUNT/2; i++) {
-        if (m_pagetable[i]) {
-            m_pagetable[i]->Dump(f, i * LX_PAGE_SIZE);
+    for (u32 i = 0; i < Tables; i++) {
+        if (m_tables[i] == NULL) continue;
+        for (u32 j = 0; j < PagesPerTable; j++) {
+            if (m_tables[i]->Pages[j])
+                m_tables[i]->Pages[j]->Dump(f, PAGE_ADDR((i << TableBits) + j));
         }
     }
 }
 
-Taint MemoryTaint::GetByte( u32 addr )
-{
-    return GetPage(addr)->Get(PAGE_LOW(addr));
-}
-
-void MemoryTaint::SetByte( u32 addr, const Taint &t )
-{
-    GetPage(addr)->Set(PAGE_LOW(addr), t);
-}
-
-
 void MemoryTaint::PageTaint::Dump( File &f, u32 base ) const
 {
     for (u32 i = 0; i < LX_PAGE_SIZE; i++) {
-        if (!m_data[i]) continue;
-        if (!m_data[i]->IsAnyTainted()) continue;
+        if (!Data[i].IsAnyTainted()) continue;
         fprintf(f.Ptr(), "%08x: ", base + i);
-        m_data[i]->Dump(f);
+        Data[i].Dump(f);
     }
 }
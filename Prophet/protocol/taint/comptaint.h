@@ -20,36 +20,48 @@ struct ProcessorTaint {
     void        Dump(File &f) const;
 };
 
+/*
+ * Shadow memory of the lower 2GB, one Taint per byte
+ * Pages are reached through a two-level table; unmapped pages read as a
+ * shared clean page, so reads never allocate and only writing taint
+ * materializes a page
+ * Tables and pages are reference counted and shared between copies (see Clone
+ * and CopyFrom) until one of them writes
+ */
 class MemoryTaint {
 
-    struct PageTaint { 
-        Taint   Get(u32 offset);
-        void    Set(u32 offset, const Taint &t);
-        void    Reset();
+    struct PageTaint {
+        LONG        Refs;
+        Taint       Data[LX_PAGE_SIZE];
 
-        PageTaint * Clone() const;
-        void        CopyFrom(const PageTaint *t);
+        PageTaint() : Refs(1) {}
+        PageTaint(const PageTaint &t);
         void        Dump(File &f, u32 base) const;
+    };
 
-        PageTaint();
-        ~PageTaint();
+    static const u32 Pages = LX_PAGE_COUNT/2;   // No address above 0x7fffffff
+    static const u32 TableBits = 10;
+    static const u32 PagesPerTable = 1 << TableBits;
+    static const u32 Tables = Pages / PagesPerTable;
 
-    private:
-        Taint *     m_data[LX_PAGE_SIZE];
+    struct PageTable {
+        LONG        Refs;
+        PageTaint * Pages[PagesPerTable];
     };
 
-
 public:
     MemoryTaint();
     ~MemoryTaint();
 
     template <int N>
-    Tb<N>       Get(u32 addr);
+    Tb<N>       Get(u32 addr) const;
 
     template <int N>
     void        Set(u32 addr, const Tb<N> &t);
 
-    Taint       GetByte(u32 addr);
+    const Taint &   GetByte(u32 addr) const {
+        return GetPage(addr)->Data[PAGE_LOW(addr)];
+    }
     void        SetByte(u32 addr, const Taint &t);
 
     void        Reset();
@@ -59,20 +71,35 @@ public:
 
     void            Dump(File &f) const;
 private:
-    PageTaint *  GetPage(u32 addr);
+    const PageTaint *   GetPage(u32 addr) const {
+        Assert((addr & 0x80000000) == 0);
+        const PageTable *table = m_tables[PAGE_NUM(addr) >> TableBits];
+        if (table == NULL) return &CleanPage;
+        const PageTaint *page = table->Pages[PAGE_NUM(addr) & (PagesPerTable - 1)];
+        return page ? page : &CleanPage;
+    }
+    PageTaint *     GetWritablePage(u32 addr);
+
+    static void     ReleasePage(PageTaint *page);
+    static void     ReleaseTable(PageTable *table);
 
 private:
-    static const u32 Pages = LX_PAGE_COUNT/2;   // No address above 0x7fffffff
-    PageTaint ** m_pagetable;
+    static const PageTaint  CleanPage;
+    PageTable *  m_tables[Tables];
 };
 
 template <int N>
-Tb<N> MemoryTaint::Get( u32 addr )
+Tb<N> MemoryTaint::Get( u32 addr ) const
 {
     Assert((addr & 0x80000000) == 0);
     Tb<N> res;
-    for (int i = 0; i < N; i++) {
-        res[i]  = GetByte(addr+i);
+    if (PAGE_LOW(addr) + N <= LX_PAGE_SIZE) {
+        const Taint *src = GetPage(addr)->Data + PAGE_LOW(addr);
+        for (int i = 0; i < N; i++)
+            res[i]  = src[i];
+    } else {
+        for (int i = 0; i < N; i++)
+            res[i]  = GetByte(addr+i);
     }
     return res;
 }
@@ -81,8 +108,15 @@ template <int N>
 void MemoryTaint::Set( u32 addr, const Tb<N> &t )
 {
     Assert((addr & 0x80000000) == 0);
-    for (int i = 0; i < N; i++) {
-        SetByte(addr+i, t[i]);
+    if (PAGE_LOW(addr) + N <= LX_PAGE_SIZE) {
+        // clean bytes written into a clean page change nothing
+        if (GetPage(addr) == &CleanPage && !t.IsAnyTainted()) return;
+        Taint *dest = GetWritablePage(addr)->Data + PAGE_LOW(addr);
+        for (int i = 0; i < N; i++)
+            dest[i] = t[i];
+    } else {
+        for (int i = 0; i < N; i++)
+            SetByte(addr+i, t[i]);
     }
 }
 
@@ -1,28 +1,203 @@
 #include "stdafx.h"
 #include "taint.h"
+#include "taintbits.h"
 #include "utilities.h"
 
-Taint::Taint( )
+volatile LONG Taint::s_width = 0;
+
+void Taint::WidenShared( int width )
+{
+    LONG curr = s_width;
+    while (width > curr) {
+        LONG prev = InterlockedCompareExchange(&s_width, width, curr);
+        if (prev == curr) break;
+        curr = prev;
+    }
+}
+
+/*
+ * Number of bitmap words needed to hold 'index', rounded up for the kernels
+ */
+static int WordsFor(int index)
+{
+    return (index / 32 + 8) & ~7;
+}
+
+TaintBits * Taint::AllocBits( int words )
+{
+    Assert(words > 0 && words % 8 == 0);
+    TaintBits *bits = (TaintBits *) malloc(sizeof(TaintBits) + sizeof(u32) * (words - 1));
+    bits->Refs = 1;
+    bits->Words = words;
+    ZeroMemory(bits->Data, sizeof(u32) * words);
+    return bits;
+}
+
+void Taint::FreeBits()
 {
-    ZeroMemory(m_data, sizeof(m_data));
+    if (IsBitmap() && InterlockedDecrement(&m_bits->Refs) == 0)
+        free(m_bits);
 }
 
 Taint::Taint( const Taint &t )
 {
-    memcpy(m_data, t.m_data, sizeof(m_data));
-//     for (int i = 0; i < Count; i++)
-//         m_data[i] = t.m_data[i];
+    m_size = t.m_size;
+    if (t.IsBitmap()) {
+        m_bits = t.m_bits;
+        InterlockedIncrement(&m_bits->Refs);
+    } else {
+        memcpy(m_labels, t.m_labels, sizeof(m_labels));
+    }
+}
+
+Taint::Taint( Taint &&t )
+{
+    m_size = t.m_size;
+    memcpy(m_labels, t.m_labels, sizeof(m_labels));     // also moves m_bits
+    t.m_size = 0;
 }
 
 Taint & Taint::operator=( Taint rhs )
 {
-    memcpy(m_data, rhs.m_data, sizeof(m_data));
+    Swap(rhs);
     return *this;
 }
 
-Taint::~Taint()
+void Taint::Swap( Taint &t )
+{
+    u32 labels[InlineCount];
+    memcpy(labels, m_labels, sizeof(m_labels));
+    memcpy(m_labels, t.m_labels, sizeof(m_labels));
+    memcpy(t.m_labels, labels, sizeof(m_labels));
+    std::swap(m_size, t.m_size);
+}
+
+bool Taint::AnyBits() const
 {
-    //SAFE_DELETE_ARRAY(m_data);
+    Assert(IsBitmap());
+    return !g_taintBits.IsZero(m_bits->Data, m_bits->Words);
+}
+
+int Taint::LabelCount() const
+{
+    return IsBitmap() ? g_taintBits.Count(m_bits->Data, m_bits->Words) : m_size;
+}
+
+bool Taint::IsAllTainted() const
+{
+    // every label is below the width, see Set
+    const int width = s_width;
+    return width > 0 && LabelCount() == width;
+}
+
+void Taint::ToBitmap( int words )
+{
+    if (IsBitmap()) {
+        MakeWritable(words);
+        return;
+    }
+    if (m_size > 0) words = max(words, WordsFor(m_labels[m_size - 1]));
+    TaintBits *bits = AllocBits(max(words, 8));
+    for (int i = 0; i < m_size; i++)
+        bits->Data[m_labels[i] / 32] |= 1 << (m_labels[i] % 32);
+    m_bits = bits;
+    m_size = Bitmap;
+}
+
+void Taint::MakeWritable( int words )
+{
+    Assert(IsBitmap());
+    if (m_bits->Refs == 1 && m_bits->Words >= words) return;
+    TaintBits *bits = AllocBits(max(words, m_bits->Words));
+    memcpy(bits->Data, m_bits->Data, sizeof(u32) * m_bits->Words);
+    FreeBits();
+    m_bits = bits;
+}
+
+void Taint::Compact()
+{
+    if (!IsBitmap()) return;
+    if (LabelCount() > InlineCount) return;
+    u32 labels[InlineCount];
+    int n = 0;
+    for (int index = Next(0); index != -1; index = Next(index + 1))
+        labels[n++] = index;
+    FreeBits();
+    memcpy(m_labels, labels, sizeof(u32) * n);
+    m_size = (u16) n;
+}
+
+int Taint::Next( int from ) const
+{
+    if (!IsBitmap()) {
+        for (int i = 0; i < m_size; i++)
+            if (m_labels[i] >= (u32) from) return m_labels[i];
+        return -1;
+    }
+    int i = from / 32;
+    if (i >= m_bits->Words) return -1;
+    u32 word = m_bits->Data[i] & (0xffffffff << (from % 32));
+    while (true) {
+        if (word != 0) {
+            unsigned long bit;
+            _BitScanForward(&bit, word);
+            return i * 32 + bit;
+        }
+        if (++i == m_bits->Words) return -1;
+        word = m_bits->Data[i];
+    }
+}
+
+void Taint::Set( int index )
+{
+    Assert(index >= 0);
+    Widen(index + 1);
+    if (IsBitmap()) {
+        if (IsTainted(index)) return;
+        MakeWritable(WordsFor(index));
+        m_bits->Data[index / 32] |= 1 << (index % 32);
+        return;
+    }
+    int pos = 0;
+    while (pos < m_size && m_labels[pos] < (u32) index) pos++;
+    if (pos < m_size && m_labels[pos] == (u32) index) return;
+    if (m_size == InlineCount) {
+        ToBitmap(WordsFor(index));
+        m_bits->Data[index / 32] |= 1 << (index % 32);
+        return;
+    }
+    memmove(m_labels + pos + 1, m_labels + pos, sizeof(u32) * (m_size - pos));
+    m_labels[pos] = index;
+    m_size++;
+}
+
+void Taint::Reset( int index )
+{
+    Assert(index >= 0);
+    if (IsBitmap()) {
+        if (!IsTainted(index)) return;
+        MakeWritable(0);
+        m_bits->Data[index / 32] &= ~(1 << (index % 32));
+        return;
+    }
+    for (int pos = 0; pos < m_size; pos++) {
+        if (m_labels[pos] != (u32) index) continue;
+        memmove(m_labels + pos, m_labels + pos + 1, sizeof(u32) * (m_size - pos - 1));
+        m_size--;
+        return;
+    }
+}
+
+void Taint::SetAll()
+{
+    ResetAll();
+    const int width = s_width;      // may grow meanwhile on another thread
+    if (width == 0) return;
+    ToBitmap(WordsFor(width - 1));
+    memset(m_bits->Data, 0xff, sizeof(u32) * (width / 32));
+    if (width % 32)
+        m_bits->Data[width / 32] = (1 << (width % 32)) - 1;
+    Compact();
 }
 
 Taint Taint::operator&( const Taint &rhs ) const
@@ -48,37 +223,124 @@ Taint Taint::operator^( const Taint &rhs ) const
 
 Taint Taint::operator~() const
 {
-    Taint t = *this;
-    for (int i = 0; i < Count; i++)
-        t.m_data[i] = ~t.m_data[i];
+    Taint t;
+    t.SetAll();
+    t ^= *this;
     return t;
 }
 
 Taint& Taint::operator&=( const Taint &rhs )
 {
-    for (int i = 0; i < Count; i++)
-        m_data[i] &= rhs.m_data[i];
+    if (this == &rhs || m_size == 0) return *this;
+    if (!IsBitmap()) {
+        int n = 0;
+        for (int i = 0; i < m_size; i++)
+            if (rhs.IsTainted(m_labels[i])) m_labels[n++] = m_labels[i];
+        m_size = (u16) n;
+    } else if (!rhs.IsBitmap()) {
+        // the result is a subset of the inline labels of rhs
+        u32 labels[InlineCount];
+        int n = 0;
+        for (int i = 0; i < rhs.m_size; i++)
+            if (IsTainted(rhs.m_labels[i])) labels[n++] = rhs.m_labels[i];
+        FreeBits();
+        memcpy(m_labels, labels, sizeof(u32) * n);
+        m_size = (u16) n;
+    } else if (m_bits != rhs.m_bits) {
+        MakeWritable(0);
+        int n = min(m_bits->Words, rhs.m_bits->Words);
+        g_taintBits.And(m_bits->Data, rhs.m_bits->Data, n);
+        ZeroMemory(m_bits->Data + n, sizeof(u32) * (m_bits->Words - n));
+        Compact();
+    }
     return *this;
 }
 
 Taint& Taint::operator|=( const Taint &rhs )
 {
-    for (int i = 0; i < Count; i++)
-        m_data[i] |= rhs.m_data[i];
+    if (this == &rhs || rhs.m_size == 0) return *this;
+    if (m_size == 0) {
+        *this = rhs;
+    } else if (rhs.IsBitmap()) {
+        if (!IsBitmap()) {
+            // start from a shared copy of the larger side
+            Taint t = rhs;
+            for (int i = 0; i < m_size; i++)
+                t.Set(m_labels[i]);
+            Swap(t);
+        } else if (m_bits != rhs.m_bits) {
+            MakeWritable(rhs.m_bits->Words);
+            g_taintBits.Or(m_bits->Data, rhs.m_bits->Data, rhs.m_bits->Words);
+        }
+    } else if (IsBitmap()) {
+        for (int i = 0; i < rhs.m_size; i++)
+            Set(rhs.m_labels[i]);
+    } else {
+        // merge the two sorted label arrays
+        u32 merged[InlineCount * 2];
+        int i = 0, j = 0, n = 0;
+        while (i < m_size || j < rhs.m_size) {
+            if (j == rhs.m_size || (i < m_size && m_labels[i] < rhs.m_labels[j]))
+                merged[n++] = m_labels[i++];
+            else if (i == m_size || rhs.m_labels[j] < m_labels[i])
+                merged[n++] = rhs.m_labels[j++];
+            else {
+                merged[n++] = m_labels[i++]; j++;
+            }
+        }
+        if (n <= InlineCount) {
+            memcpy(m_labels, merged, sizeof(u32) * n);
+            m_size = (u16) n;
+        } else {
+            TaintBits *bits = AllocBits(WordsFor(merged[n - 1]));
+            for (int k = 0; k < n; k++)
+                bits->Data[merged[k] / 32] |= 1 << (merged[k] % 32);
+            m_bits = bits;
+            m_size = Bitmap;
+        }
+    }
     return *this;
 }
 
 Taint& Taint::operator^=( const Taint &rhs )
 {
-    for (int i = 0; i < Count; i++)
-        m_data[i] ^= rhs.m_data[i];
+    if (this == &rhs) {
+        ResetAll();
+        return *this;
+    }
+    if (rhs.m_size == 0) return *this;
+    if (rhs.IsBitmap()) {
+        ToBitmap(rhs.m_bits->Words);
+        g_taintBits.Xor(m_bits->Data, rhs.m_bits->Data, rhs.m_bits->Words);
+    } else {
+        ToBitmap(WordsFor(rhs.m_labels[rhs.m_size - 1]));
+        for (int i = 0; i < rhs.m_size; i++)
+            m_bits->Data[rhs.m_labels[i] / 32] ^= 1 << (rhs.m_labels[i] % 32);
+    }
+    Compact();
     return *this;
 }
 
 bool Taint::operator==(const Taint &rhs) const
 {
-    for (int i = 0; i < Count; i++)
-        if (m_data[i] != rhs.m_data[i]) return false;
+    if (!IsBitmap() && !rhs.IsBitmap()) {
+        return m_size == rhs.m_size &&
+            memcmp(m_labels, rhs.m_labels, sizeof(u32) * m_size) == 0;
+    }
+    if (IsBitmap() && rhs.IsBitmap()) {
+        if (m_bits == rhs.m_bits) return true;
+        const TaintBits *a = m_bits, *b = rhs.m_bits;
+        if (a->Words > b->Words) std::swap(a, b);
+        return g_taintBits.Equal(a->Data, b->Data, a->Words) &&
+            g_taintBits.IsZero(b->Data + a->Words, b->Words - a->Words);
+    }
+
+    // a bitmap may hold as few labels as an inline taint
+    const Taint &bitmap = IsBitmap() ? *this : rhs;
+    const Taint &labels = IsBitmap() ? rhs : *this;
+    if (bitmap.LabelCount() != labels.m_size) return false;
+    for (int i = 0; i < labels.m_size; i++)
+        if (!bitmap.IsTainted(labels.m_labels[i])) return false;
     return true;
 }
 
@@ -89,18 +351,15 @@ bool Taint::operator!=(const Taint &rhs) const
 
 std::string Taint::ToString() const
 {
-    std::string r;
-    for (int i = 0; i < Width; i++)
-        r += (char) ('0' + (IsTainted(i) ? 1 : 0));
+    std::string r(s_width, '0');
+    for (int i = Next(0); i != -1; i = Next(i + 1))
+        r[i] = '1';
     return r;
 }
 
 Taint Taint::FromBinString( const std::string &s )
 {
     Taint r;
-    if (s.size() > Width) {
-        LxFatal("Size of string exceeded width of Taint\n");
-    }
     for (uint i = 0; i < s.size(); i++) {
         int val = s[i] - '0';
         if (val != 0 && val != 1)
@@ -112,21 +371,14 @@ Taint Taint::FromBinString( const std::string &s )
 
 void Taint::Dump( File &f ) const
 {
-    bool prev = IsTainted(0);
-    int start = 0;
-    for (int i = 1; i <= Width; i++) {
-        if (i != Width && IsTainted(i)) {
-            if (!prev) { start = i; }
-            prev = true;
-        } else if (prev) {
-            if (start == i-1)
-                fprintf(f.Ptr(), "%d ", start);
-            else
-                fprintf(f.Ptr(), "%d-%d ", start, i-1);
-            prev = false;
-        }
+    auto regions = GenerateRegions();
+    for (auto &r : regions) {
+        if (r.Len == 1)
+            fprintf(f.Ptr(), "%d ", r.Offset);
+        else
+            fprintf(f.Ptr(), "%d-%d ", r.Offset, r.Offset + r.Len - 1);
     }
-    if (!IsAnyTainted())
+    if (regions.empty())
         fprintf(f.Ptr(), "None");
     fprintf(f.Ptr(), "\n");
 }
@@ -134,16 +386,9 @@ void Taint::Dump( File &f ) const
 std::vector<TaintRegion> Taint::GenerateRegions() const
 {
     std::vector<TaintRegion> r;
-    bool prev = IsTainted(0);
-    int start = 0;
-    for (int i = 1; i <= Width; i++) {
-        if (i != Width && IsTainted(i)) {
-            if (!prev) { start = i; }
-            prev = true;
-        } else if (prev) {
-            r.emplace_back(start, i - start);
-            prev = false;
-        }
+    for (int i = Next(0); i != -1; i = Next(i + 1)) {
+        if (r.empty() || !r.back().TryMerge(TaintRegion(i, 1)))
+            r.emplace_back(i, 1);
     }
     return r;
 }
@@ -152,22 +397,12 @@ std::vector<TaintRegion> Taint::GenerateRegions() const
 void GetTaintRange( const Taint &t, int *firstIndex, int *lastIndex )
 {
     if (firstIndex) {
-        *firstIndex = -1;
-        for (int i = 0; i < t.GetWidth(); i++) {
-            if (t.IsTainted(i)) {
-                *firstIndex = i;
-                break;
-            }
-        }
+        *firstIndex = t.Next(0);
     }
 
     if (lastIndex) {
         *lastIndex = -1;
-        for (int i = t.GetWidth() - 1; i >= 0; i--) {
-            if (t.IsTainted(i)) {
-                *lastIndex = i;
-                break;
-            }
-        }
+        for (int i = t.Next(0); i != -1; i = t.Next(i + 1))
+            *lastIndex = i;
     }
 }
@@ -22,41 +22,52 @@ struct TaintRegion {
     }
 };
 
-// Per BYTE Taint structure
+/*
+ * Bitmap of a Taint with more than Taint::InlineCount labels
+ * Shared between copies and duplicated before a write (see Taint::MakeWritable)
+ */
+struct TaintBits {
+    LONG        Refs;
+    int         Words;      // always a multiple of 8
+    u32         Data[1];
+};
+
+/*
+ * Per BYTE Taint structure
+ * A set of taint labels stored adaptively: up to InlineCount labels are kept
+ * sorted inside the object, larger sets spill into a shared bitmap
+ * The label space is unbounded; GetWidth() is the number of labels handed out
+ * so far, which complement, SetAll and IsAllTainted are relative to
+ */
 class Taint {
 public:
     
-    Taint();
+    Taint() : m_size(0) {}
     Taint(const Taint &t);
+    Taint(Taint &&t);
     Taint &operator=(Taint rhs);
-    virtual ~Taint();
+    ~Taint() { FreeBits(); }
 
-    static int  GetWidth() { return Width; }
+    static int  GetWidth() { return s_width; }
+    static void Widen(int width) { if (width > s_width) WidenShared(width); }
 
     bool        IsTainted(int index) const { 
-        Assert(index < Width);
-        int i = index / 32;
-        int s = index % 32;
-        return ((m_data[i] >> s) & 1) != 0;
-    }
-
-    bool        IsAllTainted() const {
-        for (int i = 0; i < Count; i++)
-            if (m_data[i] != 0xffffffff) return false;
-        return true;
+        Assert(index >= 0);
+        if (IsBitmap()) {
+            return index / 32 < m_bits->Words &&
+                ((m_bits->Data[index / 32] >> (index % 32)) & 1) != 0;
+        }
+        for (int i = 0; i < m_size; i++) {
+            if (m_labels[i] >= (u32) index) return m_labels[i] == (u32) index;
+        }
+        return false;
     }
 
+    bool        IsAllTainted() const;
     bool        IsAllUntainted() const {
-        for (int i = 0; i < Count; i++)
-            if (m_data[i] != 0) return false;
-        return true;
-    }
-
-    bool        IsAnyTainted() const {
-        for (int i = 0; i < Count; i++)
-            if (m_data[i] != 0) return true;
-        return false;
+        return IsBitmap() ? !AnyBits() : m_size == 0;
     }
+    bool        IsAnyTainted() const { return !IsAllUntainted(); }
 
     bool        IsRangeAllTainted(int first, int last) const {
         for (int i = first; i <= last; i++)
@@ -65,31 +76,22 @@ public:
     }
 
     bool        IsRangeAllUntainted(int first, int last) const {
-        for (int i = first; i <= last; i++)
-            if (IsTainted(i)) return false;
-        return true;
+        int next = Next(first);
+        return next == -1 || next > last;
     }
 
-    void        Set(int index) { 
-        Assert(index < Width); 
-        int i = index / 32;
-        int s = index % 32;
-        m_data[i] |= (1 << s);
-    }
-
-    void        Reset(int index) { 
-        Assert(index < Width); 
-        int i = index / 32;
-        int s = index % 32;
-        m_data[i] &= ~(1 << s);
-    }
-
-    void        SetAll() {
-        memset(m_data, 0xff, sizeof(m_data));
-    }
+    /*
+     * Smallest tainted index not below 'from', -1 if there is none
+     */
+    int         Next(int from) const;
+    int         LabelCount() const;
 
+    void        Set(int index);
+    void        Reset(int index);
+    void        SetAll();
     void        ResetAll() {
-        memset(m_data, 0, sizeof(m_data));
+        FreeBits();
+        m_size = 0;
     }
 
     Taint       operator&(const Taint &rhs) const;
@@ -109,10 +111,28 @@ public:
     static Taint    FromBinString(const std::string &s);
 
 public:
-    static const int    Count = 32;
-    static const int    Width = 32 * Count;
+    static const int    InlineCount = 4;
 private:
-    u32         m_data[Count];
+    static const u16    Bitmap = 0xffff;    // m_size of a taint stored in m_bits
+
+    bool        IsBitmap() const { return m_size == Bitmap; }
+    bool        AnyBits() const;
+    void        ToBitmap(int words);
+    void        MakeWritable(int words);
+    void        Compact();
+    void        FreeBits();
+    void        Swap(Taint &t);
+
+    static TaintBits *  AllocBits(int words);
+    static void         WidenShared(int width);
+private:
+    u16         m_size;     // number of inline labels, or Bitmap
+    union {
+        u32         m_labels[InlineCount];  // sorted
+        TaintBits * m_bits;
+    };
+
+    static volatile LONG    s_width;    // shared by the analysis threads
 };
 
 void    GetTaintRange(const Taint &t, int *firstIndex, int *lastIndex);
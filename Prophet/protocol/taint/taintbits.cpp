@@ -0,0 +1,384 @@
+#include "stdafx.h"
+#include "taintbits.h"
+#include <intrin.h>
+#include <immintrin.h>
+
+/*
+ * Plain C
+ */
+
+static void ScalarOr(u32 *dest, const u32 *src, int nWords)
+{
+    for (int i = 0; i < nWords; i++)
+        dest[i] |= src[i];
+}
+
+static void ScalarAnd(u32 *dest, const u32 *src, int nWords)
+{
+    for (int i = 0; i < nWords; i++)
+        dest[i] &= src[i];
+}
+
+static void ScalarXor(u32 *dest, const u32 *src, int nWords)
+{
+    for (int i = 0; i < nWords; i++)
+        dest[i] ^= src[i];
+}
+
+static void ScalarNot(u32 *dest, int nWords)
+{
+    for (int i = 0; i < nWords; i++)
+        dest[i] = ~dest[i];
+}
+
+static bool ScalarIsZero(const u32 *src, int nWords)
+{
+    for (int i = 0; i < nWords; i++)
+        if (src[i] != 0) return false;
+    return true;
+}
+
+static bool ScalarIsOnes(const u32 *src, int nWords)
+{
+    for (int i = 0; i < nWords; i++)
+        if (src[i] != 0xffffffff) return false;
+    return true;
+}
+
+static bool ScalarEqual(const u32 *a, const u32 *b, int nWords)
+{
+    for (int i = 0; i < nWords; i++)
+        if (a[i] != b[i]) return false;
+    return true;
+}
+
+static int ScalarCount(const u32 *src, int nWords)
+{
+    int n = 0;
+    for (int i = 0; i < nWords; i++) {
+        u32 x = src[i];
+        x = x - ((x >> 1) & 0x55555555);
+        x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+        n += (((x + (x >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24;
+    }
+    return n;
+}
+
+/*
+ * SSE2, 4 words at a time
+ */
+
+static void Sse2Or(u32 *dest, const u32 *src, int nWords)
+{
+    int i = 0;
+    for (; i + 4 <= nWords; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i *) (dest + i));
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        _mm_storeu_si128((__m128i *) (dest + i), _mm_or_si128(d, s));
+    }
+    ScalarOr(dest + i, src + i, nWords - i);
+}
+
+static void Sse2And(u32 *dest, const u32 *src, int nWords)
+{
+    int i = 0;
+    for (; i + 4 <= nWords; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i *) (dest + i));
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        _mm_storeu_si128((__m128i *) (dest + i), _mm_and_si128(d, s));
+    }
+    ScalarAnd(dest + i, src + i, nWords - i);
+}
+
+static void Sse2Xor(u32 *dest, const u32 *src, int nWords)
+{
+    int i = 0;
+    for (; i + 4 <= nWords; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i *) (dest + i));
+        __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        _mm_storeu_si128((__m128i *) (dest + i), _mm_xor_si128(d, s));
+    }
+    ScalarXor(dest + i, src + i, nWords - i);
+}
+
+static void Sse2Not(u32 *dest, int nWords)
+{
+    const __m128i ones = _mm_set1_epi32(-1);
+    int i = 0;
+    for (; i + 4 <= nWords; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i *) (dest + i));
+        _mm_storeu_si128((__m128i *) (dest + i), _mm_xor_si128(d, ones));
+    }
+    ScalarNot(dest + i, nWords - i);
+}
+
+static bool Sse2IsZero(const u32 *src, int nWords)
+{
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= nWords; i += 4)
+        acc = _mm_or_si128(acc, _mm_loadu_si128((const __m128i *) (src + i)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(acc, _mm_setzero_si128())) == 0xffff &&
+        ScalarIsZero(src + i, nWords - i);
+}
+
+static bool Sse2IsOnes(const u32 *src, int nWords)
+{
+    __m128i acc = _mm_set1_epi32(-1);
+    int i = 0;
+    for (; i + 4 <= nWords; i += 4)
+        acc = _mm_and_si128(acc, _mm_loadu_si128((const __m128i *) (src + i)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(acc, _mm_set1_epi32(-1))) == 0xffff &&
+        ScalarIsOnes(src + i, nWords - i);
+}
+
+static bool Sse2Equal(const u32 *a, const u32 *b, int nWords)
+{
+    __m128i diff = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= nWords; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *) (a + i));
+        __m128i y = _mm_loadu_si128((const __m128i *) (b + i));
+        diff = _mm_or_si128(diff, _mm_xor_si128(x, y));
+    }
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(diff, _mm_setzero_si128())) == 0xffff &&
+        ScalarEqual(a + i, b + i, nWords - i);
+}
+
+/*
+ * AVX2, 8 words at a time; counting relies on POPCNT, which every AVX2 CPU has
+ */
+
+static void Avx2Or(u32 *dest, const u32 *src, int nWords)
+{
+    int i = 0;
+    for (; i + 8 <= nWords; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dest + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        _mm256_storeu_si256((__m256i *) (dest + i), _mm256_or_si256(d, s));
+    }
+    _mm256_zeroupper();
+    ScalarOr(dest + i, src + i, nWords - i);
+}
+
+static void Avx2And(u32 *dest, const u32 *src, int nWords)
+{
+    int i = 0;
+    for (; i + 8 <= nWords; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dest + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        _mm256_storeu_si256((__m256i *) (dest + i), _mm256_and_si256(d, s));
+    }
+    _mm256_zeroupper();
+    ScalarAnd(dest + i, src + i, nWords - i);
+}
+
+static void Avx2Xor(u32 *dest, const u32 *src, int nWords)
+{
+    int i = 0;
+    for (; i + 8 <= nWords; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dest + i));
+        __m256i s = _mm256_loadu_si256((const __m256i *) (src + i));
+        _mm256_storeu_si256((__m256i *) (dest + i), _mm256_xor_si256(d, s));
+    }
+    _mm256_zeroupper();
+    ScalarXor(dest + i, src + i, nWords - i);
+}
+
+static void Avx2Not(u32 *dest, int nWords)
+{
+    const __m256i ones = _mm256_set1_epi32(-1);
+    int i = 0;
+    for (; i + 8 <= nWords; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dest + i));
+        _mm256_storeu_si256((__m256i *) (dest + i), _mm256_xor_si256(d, ones));
+    }
+    _mm256_zeroupper();
+    ScalarNot(dest + i, nWords - i);
+}
+
+static bool Avx2IsZero(const u32 *src, int nWords)
+{
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= nWords; i += 8)
+        acc = _mm256_or_si256(acc, _mm256_loadu_si256((const __m256i *) (src + i)));
+    bool r = _mm256_testz_si256(acc, acc) != 0;
+    _mm256_zeroupper();
+    return r && ScalarIsZero(src + i, nWords - i);
+}
+
+static bool Avx2IsOnes(const u32 *src, int nWords)
+{
+    const __m256i ones = _mm256_set1_epi32(-1);
+    __m256i acc = ones;
+    int i = 0;
+    for (; i + 8 <= nWords; i += 8)
+        acc = _mm256_and_si256(acc, _mm256_loadu_si256((const __m256i *) (src + i)));
+    bool r = _mm256_testc_si256(acc, ones) != 0;
+    _mm256_zeroupper();
+    return r && ScalarIsOnes(src + i, nWords - i);
+}
+
+static bool Avx2Equal(const u32 *a, const u32 *b, int nWords)
+{
+    __m256i diff = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= nWords; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *) (a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i *) (b + i));
+        diff = _mm256_or_si256(diff, _mm256_xor_si256(x, y));
+    }
+    bool r = _mm256_testz_si256(diff, diff) != 0;
+    _mm256_zeroupper();
+    return r && ScalarEqual(a + i, b + i, nWords - i);
+}
+
+static int PopcntCount(const u32 *src, int nWords)
+{
+    int n = 0;
+    for (int i = 0; i < nWords; i++)
+        n += __popcnt(src[i]);
+    return n;
+}
+
+
+const TaintBitOps TaintBitsScalar = {
+    ScalarOr, ScalarAnd, ScalarXor, ScalarNot,
+    ScalarIsZero, ScalarIsOnes, ScalarEqual, ScalarCount, "scalar"
+};
+
+static const TaintBitOps TaintBitsSse2 = {
+    Sse2Or, Sse2And, Sse2Xor, Sse2Not,
+    Sse2IsZero, Sse2IsOnes, Sse2Equal, ScalarCount, "sse2"
+};
+
+static const TaintBitOps TaintBitsAvx2 = {
+    Avx2Or, Avx2And, Avx2Xor, Avx2Not,
+    Avx2IsZero, Avx2IsOnes, Avx2Equal, PopcntCount, "avx2"
+};
+
+enum TaintBitsLevel {
+    LevelScalar, LevelSse2, LevelAvx2
+};
+
+static TaintBitsLevel DetectTaintBits()
+{
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    const bool sse2     = (info[3] & (1 << 26)) != 0;
+    const bool popcnt   = (info[2] & (1 << 23)) != 0;
+    const bool osxsave  = (info[2] & (1 << 27)) != 0;
+
+    bool avx2 = false;
+    if (maxLeaf >= 7 && osxsave && popcnt) {
+        // the OS must also save the ymm registers
+        bool ymm = (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        avx2 = ymm && (info[1] & (1 << 5)) != 0;
+    }
+
+    if (avx2) return LevelAvx2;
+    if (sse2) return LevelSse2;
+    return LevelScalar;
+}
+
+/*
+ * Constant-initialized, so that taint code run by static initializers of other
+ * translation units finds the scalar kernels rather than null pointers
+ */
+TaintBitOps g_taintBits = {
+    ScalarOr, ScalarAnd, ScalarXor, ScalarNot,
+    ScalarIsZero, ScalarIsOnes, ScalarEqual, ScalarCount, "scalar"
+};
+
+void InitTaintBits()
+{
+    switch (DetectTaintBits()) {
+    case LevelAvx2: g_taintBits = TaintBitsAvx2; break;
+    case LevelSse2: g_taintBits = TaintBitsSse2; break;
+    default:        g_taintBits = TaintBitsScalar; break;
+    }
+    LxDebug("Taint bit kernels: %s\n", g_taintBits.Name);
+}
+
+/*
+ * Self test
+ */
+
+static u32 RandomWord()
+{
+    // sparse, dense and uniform words, so that both all-zero and all-one runs show up
+    switch (rand() % 4) {
+    case 0:     return 0;
+    case 1:     return 0xffffffff;
+    case 2:     return 1u << (rand() % 32);
+    default:    return (rand() << 17) ^ (rand() << 9) ^ rand();
+    }
+}
+
+static bool CheckKernels( const TaintBitOps &ops )
+{
+    const TaintBitOps &ref = TaintBitsScalar;
+    static const int MaxWords = 80;
+    // one word of slack on both sides catches writes past either end
+    u32 a[MaxWords + 3], b[MaxWords + 3], x[MaxWords + 3], y[MaxWords + 3];
+
+    for (int round = 0; round < 2000; round++) {
+        const int n     = rand() % (MaxWords + 1);
+        const int off   = 1 + rand() % 2;   // odd offsets leave the vectors unaligned
+        for (int i = 0; i < MaxWords + 3; i++) {
+            a[i] = RandomWord();
+            b[i] = rand() % 2 ? a[i] : RandomWord();
+        }
+        if (rand() % 4 == 0) {
+            // uniform inputs, with at most one word changed near the tail
+            u32 fill = rand() % 2 ? 0 : 0xffffffff;
+            for (int i = 0; i < MaxWords + 3; i++) a[i] = b[i] = fill;
+            if (n > 0 && rand() % 2) b[off + n - 1 - rand() % min(n, 3)] ^= 1u << (rand() % 32);
+        }
+        const u32 *pa = a + off, *pb = b + off;
+
+        if (ops.IsZero(pa, n) != ref.IsZero(pa, n) ||
+            ops.IsZero(pb, n) != ref.IsZero(pb, n) ||
+            ops.IsOnes(pa, n) != ref.IsOnes(pa, n) ||
+            ops.IsOnes(pb, n) != ref.IsOnes(pb, n) ||
+            ops.Equal(pa, pb, n) != ref.Equal(pa, pb, n) ||
+            ops.Count(pa, n) != ref.Count(pa, n)) {
+            LxError("Taint bit kernel %s: predicate mismatch on %d words\n", ops.Name, n);
+            return false;
+        }
+
+        void (*const binary[][2])(u32 *, const u32 *, int) = {
+            { ops.Or, ref.Or }, { ops.And, ref.And }, { ops.Xor, ref.Xor },
+        };
+        for (int k = 0; k < 4; k++) {
+            memcpy(x, a, sizeof(a));
+            memcpy(y, a, sizeof(a));
+            if (k < 3) {
+                binary[k][0](x + off, pb, n);
+                binary[k][1](y + off, pb, n);
+            } else {
+                ops.Not(x + off, n);
+                ref.Not(y + off, n);
+            }
+            if (memcmp(x, y, sizeof(x)) != 0) {
+                LxError("Taint bit kernel %s: operation %d differs on %d words\n", ops.Name, k, n);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool CheckTaintBits()
+{
+    TaintBitsLevel level = DetectTaintBits();
+    bool ok = true;
+    if (level >= LevelSse2) ok &= CheckKernels(TaintBitsSse2);
+    if (level >= LevelAvx2) ok &= CheckKernels(TaintBitsAvx2);
+    return ok;
+}
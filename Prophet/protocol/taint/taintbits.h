@@ -0,0 +1,40 @@
+#pragma once
+ 
+#ifndef __TAINT_TAINTBITS_H__
+#define __TAINT_TAINTBITS_H__
+ 
+#include "prophet.h"
+
+/*
+ * Word-wise kernels over Taint bitmaps, for any nWords and alignment
+ * g_taintBits starts out as plain C; InitTaintBits swaps in the best
+ * implementation for the host CPU (AVX2, SSE2 or plain C)
+ */
+struct TaintBitOps {
+    void    (*Or)       (u32 *dest, const u32 *src, int nWords);
+    void    (*And)      (u32 *dest, const u32 *src, int nWords);
+    void    (*Xor)      (u32 *dest, const u32 *src, int nWords);
+    void    (*Not)      (u32 *dest, int nWords);
+    bool    (*IsZero)   (const u32 *src, int nWords);
+    bool    (*IsOnes)   (const u32 *src, int nWords);
+    bool    (*Equal)    (const u32 *a, const u32 *b, int nWords);
+    int     (*Count)    (const u32 *src, int nWords);
+    const char *        Name;
+};
+
+extern TaintBitOps  g_taintBits;
+
+void    InitTaintBits();
+
+/*
+ * Compare the vectorized kernels the host supports with the plain C ones on
+ * random inputs, including odd lengths and unaligned buffers
+ */
+bool    CheckTaintBits();
+
+/*
+ * Portable implementation, kept as the reference for the vectorized ones
+ */
+extern const TaintBitOps    TaintBitsScalar;
+
+#endif // __TAINT_TAINTBITS_H__
@@ -9,7 +9,7 @@ TSnapshot::TSnapshot( TaintEngine &t )
     m_pt = t.CpuTaint.Clone();
     m_mt = t.MemTaint.Clone();
     m_count = t.m_count;
-    memcpy(m_desc, t.m_taintDesc, sizeof(t.m_taintDesc));
+    m_desc = t.m_taintDesc;
 }
 
 TSnapshot::~TSnapshot()
@@ -36,8 +36,7 @@ void TaintEngine::Reset()
     CpuTaint.Reset();
     MemTaint.Reset();
     m_count = 0;
-    for (auto &desc : m_taintDesc)
-        desc.Reset();
+    m_taintDesc.clear();
 }
 
 bool TaintEngine::TryGetMemRegion( const TaintRegion &t, MemRegion &m )
@@ -66,13 +65,13 @@ Taint TaintEngine::TaintByte( u32 addr )
 
 void TaintEngine::DoTaint( u32 addr )
 {
-    if (m_count >= Taint::Width) {
-        LxFatal("Too many taints!\n");
-    }
     Taint t = MemTaint.GetByte(addr);
     t.Set(m_count);
     MemTaint.SetByte(addr, t);
-    m_taintDesc[m_count++].SourceAddr = addr;
+    TaintDesc desc;
+    desc.SourceAddr = addr;
+    m_taintDesc.push_back(desc);
+    m_count++;
 }
 
 void TaintEngine::TaintMemRegion( const MemRegion &region )
@@ -138,7 +137,7 @@ void TaintEngine::ApplySnapshot( const TSnapshot &t )
     CpuTaint.CopyFrom(t.m_pt);
     MemTaint.CopyFrom(t.m_mt);
     m_count = t.m_count;
-    memcpy(m_taintDesc, t.m_desc, sizeof(t.m_desc));
+    m_taintDesc = t.m_desc;
 }
 
 
@@ -30,6 +30,11 @@ struct TaintDesc {
 };
 
 
+/*
+ * Taint state saved for a later TaintEngine::ApplySnapshot
+ * Memory taint is shared copy-on-write, so taking and applying a snapshot
+ * only costs the page tables; pages are duplicated when either side writes
+ */
 class TSnapshot {
     friend class TaintEngine;
 public:
@@ -42,7 +47,7 @@ private:
     ProcessorTaint *m_pt;
     MemoryTaint *m_mt;
     u32 m_count;
-    TaintDesc m_desc[Taint::Width];
+    std::vector<TaintDesc>  m_desc;
 };
 
 enum TaintRule {
@@ -87,7 +92,7 @@ private:
 private:
     int         m_count;
     u32         m_taintRule;
-    TaintDesc   m_taintDesc[Taint::Width];
+    std::vector<TaintDesc>  m_taintDesc;    // source of each label, grows with m_count
 private:
 
 
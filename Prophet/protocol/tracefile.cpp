@@ -0,0 +1,633 @@
+#include "stdafx.h"
+#include "tracefile.h"
+
+/*
+ * Block compressor
+ *
+ * A block is a list of sequences: a token (literal count << 4 | match length - 4,
+ * 15 in a nibble means more length bytes follow), the literals, then the 16-bit
+ * offset of the match. The last sequence has literals only
+ */
+
+static const int MinMatch   = 4;
+static const int HashBits   = 12;
+static const int MaxOffset  = 0xffff;
+
+static inline u32 Read32(cpbyte p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24);
+}
+
+static inline pbyte PutLength(pbyte op, int len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (byte) len;
+    return op;
+}
+
+static pbyte PutSequence(pbyte op, cpbyte lit, int litLen, int offset, int matchLen)
+{
+    byte *token = op++;
+    *token = (byte) (min(litLen, 15) << 4);
+    if (litLen >= 15) op = PutLength(op, litLen - 15);
+    memcpy(op, lit, litLen);
+    op += litLen;
+    if (matchLen == 0) return op;
+
+    *op++ = (byte) offset;
+    *op++ = (byte) (offset >> 8);
+    *token |= (byte) min(matchLen - MinMatch, 15);
+    if (matchLen - MinMatch >= 15) op = PutLength(op, matchLen - MinMatch - 15);
+    return op;
+}
+
+int TraceFile::Pack( cpbyte src, int n, pbyte dest )
+{
+    int table[1 << HashBits];
+    for (int i = 0; i < (1 << HashBits); i++)
+        table[i] = -1;
+
+    pbyte op = dest;
+    int anchor = 0;
+    int ip = 0;
+    while (ip + MinMatch <= n) {
+        u32 seq = Read32(src + ip);
+        u32 h = (seq * 2654435761u) >> (32 - HashBits);
+        int ref = table[h];
+        table[h] = ip;
+        if (ref < 0 || ip - ref > MaxOffset || Read32(src + ref) != seq) {
+            ip++;
+            continue;
+        }
+        int len = MinMatch;
+        while (ip + len < n && src[ref + len] == src[ip + len])
+            len++;
+        op = PutSequence(op, src + anchor, ip - anchor, ip - ref, len);
+        ip += len;
+        anchor = ip;
+    }
+    op = PutSequence(op, src + anchor, n - anchor, 0, 0);
+    return op - dest;
+}
+
+static inline bool GetLength(cpbyte &ip, cpbyte end, int &len)
+{
+    byte b;
+    do {
+        if (ip >= end) return false;
+        b = *ip++;
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+int TraceFile::Unpack( cpbyte src, int n, pbyte dest, int destLen )
+{
+    cpbyte ip = src, end = src + n;
+    pbyte op = dest, opEnd = dest + destLen;
+    while (ip < end) {
+        byte token = *ip++;
+        int litLen = token >> 4;
+        if (litLen == 15 && !GetLength(ip, end, litLen)) return -1;
+        if (litLen > end - ip || litLen > opEnd - op) return -1;
+        memcpy(op, ip, litLen);
+        op += litLen;
+        ip += litLen;
+        if (ip == end) break;
+
+        if (end - ip < 2) return -1;
+        int offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        int matchLen = token & 15;
+        if (matchLen == 15 && !GetLength(ip, end, matchLen)) return -1;
+        matchLen += MinMatch;
+        if (offset == 0 || offset > op - dest || matchLen > opEnd - op) return -1;
+        cpbyte ref = op - offset;
+        for (int i = 0; i < matchLen; i++)     // may overlap
+            op[i] = ref[i];
+        op += matchLen;
+    }
+    return op - dest;
+}
+
+/*
+ * Varints, signed values are zigzag encoded
+ */
+
+static inline u32 ZigZag(u32 delta)
+{
+    return (delta << 1) ^ (u32) ((int) delta >> 31);
+}
+
+static inline u32 UnZigZag(u32 val)
+{
+    return (val >> 1) ^ (u32) -(int) (val & 1);
+}
+
+static bool GetVar(cpbyte &ip, cpbyte end, u32 &val)
+{
+    val = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (ip >= end) return false;
+        byte b = *ip++;
+        val |= (u32) (b & 0x7f) << shift;
+        if ((b & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+static bool GetVar64(cpbyte &ip, cpbyte end, u64 &val)
+{
+    val = 0;
+    for (int shift = 0; shift < 70; shift += 7) {
+        if (ip >= end) return false;
+        byte b = *ip++;
+        val |= (u64) (b & 0x7f) << shift;
+        if ((b & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+/*
+ * TraceBlockWriter
+ */
+
+TraceBlockWriter::TraceBlockWriter( const std::string &filename, u32 magic )
+    : m_file(filename, "wb")
+{
+    m_magic = magic;
+    m_closed = false;
+    m_count = 0;
+    m_block.reserve(TraceFile::BlockSize + 256);
+    WriteHeader();
+}
+
+TraceBlockWriter::~TraceBlockWriter()
+{
+    Close();
+}
+
+void TraceBlockWriter::WriteHeader()
+{
+    TraceFile::Header header = { m_magic, TraceFile::Version, m_count };
+    fwrite(&header, sizeof(header), 1, m_file.Ptr());
+}
+
+void TraceBlockWriter::PutVar( u32 val )
+{
+    while (val >= 0x80) {
+        PutByte((byte) (val | 0x80));
+        val >>= 7;
+    }
+    PutByte((byte) val);
+}
+
+void TraceBlockWriter::PutVar64( u64 val )
+{
+    while (val >= 0x80) {
+        PutByte((byte) (val | 0x80));
+        val >>= 7;
+    }
+    PutByte((byte) val);
+}
+
+void TraceBlockWriter::PutInst( const Inst *inst )
+{
+    // the copy taken at decode time, guest memory may be gone or rewritten by now
+    Assert(inst->Length <= Inst::MaxCodeSize);
+    PutByte((byte) inst->Length);
+    m_block.insert(m_block.end(), inst->Code, inst->Code + inst->Length);
+}
+
+void TraceBlockWriter::PutAccess( const MemAccess &ma, u32 &last )
+{
+    PutVar(ZigZag(ma.Addr - last));
+    PutByte((byte) ma.Len);
+    PutVar(ma.Val);
+    last = ma.Addr;
+}
+
+void TraceBlockWriter::EndRecord()
+{
+    Assert(!m_closed);
+    m_count++;
+    if ((int) m_block.size() >= TraceFile::BlockSize)
+        Flush();
+}
+
+void TraceBlockWriter::Flush()
+{
+    if (m_block.empty()) return;
+
+    m_packed.resize(TraceFile::MaxPacked(m_block.size()));
+    u32 sizes[2];
+    sizes[0] = m_block.size();
+    sizes[1] = TraceFile::Pack(&m_block[0], m_block.size(), &m_packed[0]);
+    fwrite(sizes, sizeof(sizes), 1, m_file.Ptr());
+    fwrite(&m_packed[0], 1, sizes[1], m_file.Ptr());
+    m_block.clear();
+}
+
+void TraceBlockWriter::Close()
+{
+    if (m_closed) return;
+    Flush();
+
+    // the count is only known now
+    fseek(m_file.Ptr(), 0, SEEK_SET);
+    WriteHeader();
+    m_file.Close();
+    m_closed = true;
+}
+
+/*
+ * TraceWriter
+ */
+
+TraceWriter::TraceWriter( const std::string &filename )
+    : TraceBlockWriter(filename, TraceFile::Magic)
+{
+}
+
+void TraceWriter::Write( const TContext &ctx )
+{
+    const TContext &prev = m_state.Prev;
+
+    byte flags = 0, regMask = 0;
+    bool newInst = IsNewInst(ctx.Eip);
+    if (newInst)                        flags |= TraceFile::RecNewInst;
+    if (ctx.Mr.Addr)                    flags |= TraceFile::RecMr;
+    if (ctx.Mw.Addr)                    flags |= TraceFile::RecMw;
+    if (ctx.JumpTaken)                  flags |= TraceFile::RecJumpTaken;
+    if (ctx.Eflags != prev.Eflags)      flags |= TraceFile::RecEflags;
+    if (ctx.Tid != prev.Tid || ctx.ExtTid != prev.ExtTid)
+                                        flags |= TraceFile::RecThread;
+    if (ctx.ExecFlag != prev.ExecFlag)  flags |= TraceFile::RecExecFlag;
+    for (int i = 0; i < TContext::RegCount; i++)
+        if (ctx.Regs[i] != prev.Regs[i]) regMask |= 1 << i;
+
+    PutByte(flags);
+    PutByte(regMask);
+    PutVar(ZigZag(ctx.Eip - (prev.Eip + m_state.PrevLen)));
+    if (newInst) PutInst(ctx.Inst);
+    for (int i = 0; i < TContext::RegCount; i++)
+        if (regMask & (1 << i)) PutVar(ZigZag(ctx.Regs[i] - prev.Regs[i]));
+    if (flags & TraceFile::RecEflags)   PutVar(ctx.Eflags);
+    if (flags & TraceFile::RecThread) {
+        PutVar(ctx.Tid);
+        PutVar(ctx.ExtTid);
+    }
+    if (flags & TraceFile::RecExecFlag) PutVar(ctx.ExecFlag);
+    if (flags & TraceFile::RecMr)       PutAccess(ctx.Mr, m_state.LastMr);
+    if (flags & TraceFile::RecMw)       PutAccess(ctx.Mw, m_state.LastMw);
+
+    m_state.Prev = ctx;
+    m_state.PrevLen = ctx.Inst->Length;
+    EndRecord();
+}
+
+void TraceWriter::Write( const RunTrace &trace, int firstIncl, int lastIncl )
+{
+    for (int i = firstIncl; i <= lastIncl; i++)
+        Write(*trace.Get(i));
+}
+
+/*
+ * TraceContextWriter
+ *
+ * flags, regMask, Seq delta, Eip delta, [inst], [regs], [flags], [thread],
+ * [module id, image base, [name]], [NumMRs, NumMWs, accesses]
+ */
+
+TraceContextWriter::TraceContextWriter( const std::string &filename )
+    : TraceBlockWriter(filename, TraceFile::ContextMagic)
+{
+}
+
+void TraceContextWriter::Write( const ProTracer &tracer, const TraceContext &t )
+{
+    const TraceContext &prev = m_state.Prev;
+
+    byte flags = 0, regMask = 0;
+    bool newInst = IsNewInst(t.Eip);
+    bool newModule = (uint) t.Module >= m_knownModules.size() || !m_knownModules[t.Module];
+    if (newInst)                        flags |= TraceFile::RecNewInst;
+    if (t.NumMRs + t.NumMWs > 0)        flags |= TraceFile::RecAccesses;
+    if (t.JumpTaken)                    flags |= TraceFile::RecJumpTaken;
+    if (memcmp(t.Flags, prev.Flags, sizeof(t.Flags)) != 0)
+                                        flags |= TraceFile::RecFlags;
+    if (t.Tid != prev.Tid || t.ExternalTid != prev.ExternalTid)
+                                        flags |= TraceFile::RecThread;
+    if (t.Module != prev.Module || t.ModuleImageBase != prev.ModuleImageBase || newModule)
+                                        flags |= TraceFile::RecModule;
+    if (newModule)                      flags |= TraceFile::RecNewModule;
+    for (int i = 0; i < TraceContext::RegCount; i++)
+        if (t.Regs[i] != prev.Regs[i]) regMask |= 1 << i;
+
+    PutByte(flags);
+    PutByte(regMask);
+    PutVar64((u64) (t.Seq - prev.Seq - 1));      // seqs only grow
+    PutVar(ZigZag(t.Eip - (prev.Eip + m_state.PrevLen)));
+    if (newInst) PutInst(t.Inst);
+    for (int i = 0; i < TraceContext::RegCount; i++)
+        if (regMask & (1 << i)) PutVar(ZigZag(t.Regs[i] - prev.Regs[i]));
+    if (flags & TraceFile::RecFlags) {
+        for (int i = 0; i < TraceContext::FlagCount; i++)
+            PutByte(t.Flags[i]);
+    }
+    if (flags & TraceFile::RecThread) {
+        PutVar(t.Tid);
+        PutVar(t.ExternalTid);
+    }
+    if (flags & TraceFile::RecModule) {
+        PutVar(t.Module);
+        PutVar(t.ModuleImageBase);
+    }
+    if (newModule) {
+        const std::string &name = tracer.GetModuleName(t);
+        PutVar((u32) name.size());
+        for (uint i = 0; i < name.size(); i++)
+            PutByte((byte) name[i]);
+        if ((uint) t.Module >= m_knownModules.size())
+            m_knownModules.resize(t.Module + 1, false);
+        m_knownModules[t.Module] = true;
+    }
+    if (flags & TraceFile::RecAccesses) {
+        PutVar(t.NumMRs);
+        PutVar(t.NumMWs);
+        for (int i = 0; i < t.NumMRs; i++)
+            PutAccess(tracer.GetMr(t, i), m_state.LastMr);
+        for (int i = 0; i < t.NumMWs; i++)
+            PutAccess(tracer.GetMw(t, i), m_state.LastMw);
+    }
+
+    m_state.Prev = t;
+    m_state.PrevLen = t.Inst->Length;
+    EndRecord();
+}
+
+void TraceContextWriter::Write( const ProTracer &tracer )
+{
+    SyncObjectLock lock(tracer);
+    for (int i = 0; i < tracer.GetCount(); i++)
+        Write(tracer, tracer.GetTrace(i));
+}
+
+/*
+ * TraceBlockReader
+ */
+
+TraceBlockReader::TraceBlockReader()
+    : m_pool(1024)
+{
+    m_valid = false;
+}
+
+TraceBlockReader::~TraceBlockReader()
+{
+}
+
+void TraceBlockReader::Open( const std::string &filename, u32 magic )
+{
+    File f(filename, "rb");
+    m_valid = Load(f, magic);
+    if (!m_valid) {
+        LxError("Corrupted trace file %s, %d traces loaded\n", filename.c_str(), RecordCount());
+    }
+}
+
+bool TraceBlockReader::Load( File &f, u32 magic )
+{
+    if (f.Ptr() == NULL) return false;
+
+    TraceFile::Header header;
+    if (fread(&header, sizeof(header), 1, f.Ptr()) != 1) return false;
+    if (header.Magic != magic || header.Version != TraceFile::Version)
+        return false;
+
+    std::vector<byte> packed, block;
+    u32 sizes[2];
+    while (fread(sizes, sizeof(sizes), 1, f.Ptr()) == 1) {
+        if (sizes[1] > (u32) TraceFile::MaxPacked(sizes[0])) return false;
+        packed.resize(sizes[1] + 1);
+        block.resize(sizes[0] + 1);
+        if (fread(&packed[0], 1, sizes[1], f.Ptr()) != sizes[1]) return false;
+        if (TraceFile::Unpack(&packed[0], sizes[1], &block[0], sizes[0]) != (int) sizes[0])
+            return false;
+        if (!ReadBlock(&block[0], sizes[0])) return false;
+    }
+    return (u32) RecordCount() == header.Count;
+}
+
+bool TraceBlockReader::ReadInst( cpbyte &ip, cpbyte end, u32 eip )
+{
+    if (ip >= end) return false;
+    int len = *ip++;
+    if (len > end - ip) return false;
+    AddInst(eip, ip, len);
+    ip += len;
+    return true;
+}
+
+InstPtr TraceBlockReader::AddInst( u32 eip, cpbyte code, int len )
+{
+    // decode from a padded copy, the decoder may look past the instruction
+    byte buf[32];
+    ZeroMemory(buf, sizeof(buf));
+    memcpy(buf, code, min(len, (int) sizeof(buf)));
+
+    InstPtr inst = m_pool.Alloc();
+    LxDecode(buf, (Instruction *) inst, eip);
+    memcpy(inst->Code, buf, min(inst->Length, Inst::MaxCodeSize));
+    inst->Main.EIP = (UIntPtr) inst->Code;     // not the stack buffer above
+    inst->Eip = eip;
+    m_insts[eip] = inst;
+    return inst;
+}
+
+InstPtr TraceBlockReader::FindInst( u32 eip ) const
+{
+    std::map<u32, InstPtr>::const_iterator iter = m_insts.find(eip);
+    return iter == m_insts.end() ? NULL : iter->second;
+}
+
+static bool GetMemAccess(cpbyte &ip, cpbyte end, MemAccess &ma, u32 &last)
+{
+    u32 val;
+    if (!GetVar(ip, end, val) || ip >= end) return false;
+    ma.Addr = last + UnZigZag(val);
+    ma.Len = *ip++;
+    if (!GetVar(ip, end, ma.Val)) return false;
+    last = ma.Addr;
+    return true;
+}
+
+/*
+ * TraceReader
+ */
+
+TraceReader::TraceReader( const std::string &filename )
+    : m_trace(NULL)
+{
+    m_trace.Begin();
+    Open(filename, TraceFile::Magic);
+}
+
+TraceReader::~TraceReader()
+{
+    m_trace.End();
+}
+
+bool TraceReader::ReadBlock( cpbyte data, int n )
+{
+    cpbyte ip = data, end = data + n;
+    while (ip < end) {
+        if (end - ip < 2) return false;
+        byte flags = *ip++;
+        byte regMask = *ip++;
+
+        const TContext &prev = m_state.Prev;
+        TContext ctx;
+        ZeroMemory(&ctx, sizeof(ctx));
+        u32 val;
+        if (!GetVar(ip, end, val)) return false;
+        ctx.Eip = prev.Eip + m_state.PrevLen + UnZigZag(val);
+
+        if ((flags & TraceFile::RecNewInst) && !ReadInst(ip, end, ctx.Eip)) return false;
+        ctx.Inst = FindInst(ctx.Eip);
+        if (ctx.Inst == NULL) return false;
+
+        for (int i = 0; i < TContext::RegCount; i++) {
+            ctx.Regs[i] = prev.Regs[i];
+            if ((regMask & (1 << i)) == 0) continue;
+            if (!GetVar(ip, end, val)) return false;
+            ctx.Regs[i] += UnZigZag(val);
+        }
+
+        ctx.Eflags = prev.Eflags;
+        if ((flags & TraceFile::RecEflags) && !GetVar(ip, end, ctx.Eflags)) return false;
+        ctx.Tid = prev.Tid;
+        ctx.ExtTid = prev.ExtTid;
+        if (flags & TraceFile::RecThread) {
+            if (!GetVar(ip, end, val)) return false;
+            ctx.Tid = (int) val;
+            if (!GetVar(ip, end, val)) return false;
+            ctx.ExtTid = val;
+        }
+        ctx.ExecFlag = prev.ExecFlag;
+        if ((flags & TraceFile::RecExecFlag) && !GetVar(ip, end, ctx.ExecFlag)) return false;
+
+        if ((flags & TraceFile::RecMr) && !GetMemAccess(ip, end, ctx.Mr, m_state.LastMr))
+            return false;
+        if ((flags & TraceFile::RecMw) && !GetMemAccess(ip, end, ctx.Mw, m_state.LastMw))
+            return false;
+        ctx.JumpTaken = (flags & TraceFile::RecJumpTaken) != 0;
+
+        m_trace.Append(ctx);
+        m_state.Prev = ctx;
+        m_state.PrevLen = ctx.Inst->Length;
+    }
+    return true;
+}
+
+/*
+ * TraceContextReader
+ */
+
+TraceContextReader::TraceContextReader( const std::string &filename )
+{
+    Open(filename, TraceFile::ContextMagic);
+}
+
+bool TraceContextReader::ReadBlock( cpbyte data, int n )
+{
+    cpbyte ip = data, end = data + n;
+    while (ip < end) {
+        if (end - ip < 2) return false;
+        byte flags = *ip++;
+        byte regMask = *ip++;
+
+        const TraceContext &prev = m_state.Prev;
+        TraceContext t;
+        u32 val;
+        u64 seqDelta;
+        if (!GetVar64(ip, end, seqDelta)) return false;
+        t.Seq = prev.Seq + 1 + (i64) seqDelta;
+        if (!GetVar(ip, end, val)) return false;
+        t.Eip = prev.Eip + m_state.PrevLen + UnZigZag(val);
+
+        if ((flags & TraceFile::RecNewInst) && !ReadInst(ip, end, t.Eip)) return false;
+        t.Inst = FindInst(t.Eip);
+        if (t.Inst == NULL) return false;
+
+        for (int i = 0; i < TraceContext::RegCount; i++) {
+            t.Regs[i] = prev.Regs[i];
+            if ((regMask & (1 << i)) == 0) continue;
+            if (!GetVar(ip, end, val)) return false;
+            t.Regs[i] += UnZigZag(val);
+        }
+        memcpy(t.Flags, prev.Flags, sizeof(t.Flags));
+        if (flags & TraceFile::RecFlags) {
+            if (end - ip < TraceContext::FlagCount) return false;
+            memcpy(t.Flags, ip, sizeof(t.Flags));
+            ip += TraceContext::FlagCount;
+        }
+        t.JumpTaken = (flags & TraceFile::RecJumpTaken) != 0;
+
+        t.Tid = prev.Tid;
+        t.ExternalTid = prev.ExternalTid;
+        if (flags & TraceFile::RecThread) {
+            if (!GetVar(ip, end, val)) return false;
+            t.Tid = (int) val;
+            if (!GetVar(ip, end, val)) return false;
+            t.ExternalTid = val;
+        }
+
+        t.Module = prev.Module;
+        t.ModuleImageBase = prev.ModuleImageBase;
+        if (flags & TraceFile::RecModule) {
+            if (!GetVar(ip, end, val) || val > 0xffff) return false;
+            t.Module = (u16) val;
+            if (!GetVar(ip, end, t.ModuleImageBase)) return false;
+        }
+        if (flags & TraceFile::RecNewModule) {
+            if (!GetVar(ip, end, val) || val > (u32) (end - ip)) return false;
+            if ((uint) t.Module >= m_modules.size())
+                m_modules.resize(t.Module + 1);
+            m_modules[t.Module].assign((const char *) ip, val);
+            ip += val;
+        }
+        if ((uint) t.Module >= m_modules.size()) return false;
+
+        t.NumMRs = t.NumMWs = 0;
+        if (flags & TraceFile::RecAccesses) {
+            if (!GetVar(ip, end, val) || val > 0xffff) return false;
+            t.NumMRs = (u16) val;
+            if (!GetVar(ip, end, val) || val > 0xffffu - t.NumMRs) return false;
+            t.NumMWs = (u16) val;
+        }
+        for (int i = 0; i < t.NumMRs + t.NumMWs; i++) {
+            MemAccess ma;
+            if (!GetMemAccess(ip, end, ma, i < t.NumMRs ? m_state.LastMr : m_state.LastMw))
+                return false;
+            if (i < TraceContext::InlineAccesses) {
+                t.Accesses[i] = ma;
+                continue;
+            }
+            if (i == TraceContext::InlineAccesses) t.Overflow = (int) m_overflow.size();
+            m_overflow.push_back(ma);
+        }
+
+        m_traces.push_back(t);
+        m_state.Prev = t;
+        m_state.PrevLen = t.Inst->Length;
+    }
+    return true;
+}
+
+const MemAccess & TraceContextReader::GetAccess( const TraceContext &t, int n ) const
+{
+    if (n < TraceContext::InlineAccesses) return t.Accesses[n];
+    return m_overflow[t.Overflow + n - TraceContext::InlineAccesses];
+}
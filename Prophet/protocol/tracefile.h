@@ -0,0 +1,220 @@
+#pragma once
+ 
+#ifndef __PROPHET_PROTOCOL_TRACEFILE_H__
+#define __PROPHET_PROTOCOL_TRACEFILE_H__
+ 
+#include "prophet.h"
+#include "utilities.h"
+#include "runtrace.h"
+#include "static/disassembler.h"
+#include "dbg/tracer.h"
+
+/*
+ * Binary run trace file
+ *
+ * Header, then blocks of up to BlockSize bytes of record stream, each compressed
+ * on its own. A record stores its Eip as a delta from the fall-through address,
+ * only the registers that changed since the previous record (RegMask), and the
+ * rest only when present or changed. The bytes of every instruction are stored
+ * the first time its Eip is seen, so that a file can be replayed without the
+ * process that produced it
+ *
+ * Files of TContext (run traces) and of TraceContext (the tracer's history) share
+ * the layout and differ in Magic and record content
+ */
+class TraceFile {
+public:
+    static const u32    Magic       = 0x43525450;   // "PTRC"
+    static const u32    ContextMagic = 0x58435450;  // "PTCX"
+    static const u32    Version     = 1;
+    static const int    BlockSize   = 64 * 1024;
+
+    enum RecordFlag {
+        RecNewInst      = 1 << 0,
+        RecMr           = 1 << 1,
+        RecMw           = 1 << 2,
+        RecJumpTaken    = 1 << 3,
+        RecEflags       = 1 << 4,
+        RecThread       = 1 << 5,
+        RecExecFlag     = 1 << 6,
+    };
+
+    /*
+     * TraceContext records reuse RecNewInst, RecJumpTaken and RecThread
+     */
+    enum ContextRecordFlag {
+        RecAccesses     = 1 << 1,       // NumMRs, NumMWs and the accesses follow
+        RecFlags        = 1 << 4,       // Flags changed
+        RecModule       = 1 << 6,       // Module changed
+        RecNewModule    = 1 << 7,       // name and image base of a module seen first
+    };
+
+    struct Header {
+        u32     Magic;
+        u32     Version;
+        u32     Count;
+    };
+
+    /*
+     * What a record is encoded against; the writer and the reader keep
+     * identical copies
+     */
+    template <class T>
+    struct BasicState {
+        T           Prev;
+        int         PrevLen;
+        u32         LastMr;
+        u32         LastMw;
+
+        BasicState() { ZeroMemory(this, sizeof(BasicState)); }
+    };
+    typedef BasicState<TContext>        State;
+    typedef BasicState<TraceContext>    ContextState;
+
+    /*
+     * LZ77 block compressor, dest must hold MaxPacked(n) bytes
+     */
+    static int  MaxPacked(int n) { return n + n / 255 + 16; }
+    static int  Pack(cpbyte src, int n, pbyte dest);
+    static int  Unpack(cpbyte src, int n, pbyte dest, int destLen);
+};
+
+/*
+ * Header and block framing shared by the writers
+ */
+class TraceBlockWriter {
+public:
+    TraceBlockWriter(const std::string &filename, u32 magic);
+    virtual ~TraceBlockWriter();
+
+    void        Close();
+
+protected:
+    void        EndRecord();
+    bool        IsNewInst(u32 eip) { return m_knownInsts.insert(eip).second; }
+    void        PutInst(const Inst *inst);
+    void        PutVar(u32 val);
+    void        PutVar64(u64 val);
+    void        PutByte(byte b) { m_block.push_back(b); }
+    void        PutAccess(const MemAccess &ma, u32 &last);
+
+private:
+    void        Flush();
+    void        WriteHeader();
+
+private:
+    File        m_file;
+    u32         m_magic;
+    bool        m_closed;
+    u32         m_count;
+    std::set<u32>       m_knownInsts;
+    std::vector<byte>   m_block;
+    std::vector<byte>   m_packed;
+};
+
+class TraceWriter : public TraceBlockWriter {
+public:
+    TraceWriter(const std::string &filename);
+
+    void        Write(const TContext &ctx);
+    void        Write(const RunTrace &trace, int firstIncl, int lastIncl);
+
+private:
+    TraceFile::State    m_state;
+};
+
+/*
+ * Writes TraceContext records, with their module and every memory access
+ * (inline and overflow) looked up through the tracer that recorded them
+ */
+class TraceContextWriter : public TraceBlockWriter {
+public:
+    TraceContextWriter(const std::string &filename);
+
+    void        Write(const ProTracer &tracer, const TraceContext &t);
+    void        Write(const ProTracer &tracer);     // every live trace, oldest first
+
+private:
+    TraceFile::ContextState m_state;
+    std::vector<bool>   m_knownModules;
+};
+
+/*
+ * Block decoding and instruction rebuilding shared by the readers
+ */
+class TraceBlockReader {
+public:
+    TraceBlockReader();
+    virtual ~TraceBlockReader();
+
+    bool        IsValid() const { return m_valid; }
+
+protected:
+    void        Open(const std::string &filename, u32 magic);
+    virtual bool    ReadBlock(cpbyte data, int n) = 0;
+    virtual int     RecordCount() const = 0;
+    InstPtr     AddInst(u32 eip, cpbyte code, int len);
+    InstPtr     FindInst(u32 eip) const;
+    bool        ReadInst(cpbyte &ip, cpbyte end, u32 eip);
+
+private:
+    bool        Load(File &f, u32 magic);
+
+private:
+    bool        m_valid;
+    InstPool    m_pool;
+    std::map<u32, InstPtr>  m_insts;
+};
+
+class TraceReader : public TraceBlockReader {
+public:
+    TraceReader(const std::string &filename);
+    ~TraceReader();
+
+    /*
+     * Traces of the file, loaded on construction
+     */
+    const RunTrace &    GetTrace() const { return m_trace; }
+
+private:
+    bool        ReadBlock(cpbyte data, int n) override;
+    int         RecordCount() const override { return m_trace.Count(); }
+
+private:
+    RunTrace    m_trace;
+    TraceFile::State    m_state;
+};
+
+/*
+ * TraceContext records of a file, loaded on construction
+ * Overflow of a loaded record indexes the reader's own access list
+ */
+class TraceContextReader : public TraceBlockReader {
+public:
+    TraceContextReader(const std::string &filename);
+
+    int         GetCount() const { return (int) m_traces.size(); }
+    const TraceContext &    GetTrace(int n) const { return m_traces[n]; }
+    const MemAccess &   GetMr(const TraceContext &t, int n) const {
+        Assert(n >= 0 && n < t.NumMRs);
+        return GetAccess(t, n);
+    }
+    const MemAccess &   GetMw(const TraceContext &t, int n) const {
+        Assert(n >= 0 && n < t.NumMWs);
+        return GetAccess(t, t.NumMRs + n);
+    }
+    const std::string & GetModuleName(const TraceContext &t) const { return m_modules[t.Module]; }
+
+private:
+    bool        ReadBlock(cpbyte data, int n) override;
+    int         RecordCount() const override { return GetCount(); }
+    const MemAccess &   GetAccess(const TraceContext &t, int n) const;
+
+private:
+    std::vector<TraceContext>   m_traces;
+    std::vector<MemAccess>      m_overflow;
+    std::vector<std::string>    m_modules;
+    TraceFile::ContextState     m_state;
+};
+
+#endif // __PROPHET_PROTOCOL_TRACEFILE_H__
@@ -10,6 +10,7 @@
 #include "emulator.h"
 
 #include "protocol/runtrace.h"
+#include "dbg/tracer.h"
 
 InstSection::InstSection( InstMem *mem, InstPool &pool, u32 base, u32 size )
     : m_mem(mem), m_pool(pool), m_base(base), m_size(size), m_count(0)
@@ -183,12 +184,14 @@ void Disassembler::RecursiveDisassemble( const Processor *cpu, u32 eip,
         if (sec->Contains(eip)) break;     // already disassembled
 
         InstPtr inst = sec->Alloc(eip);
-        LxDecode(LxEmulator.Mem()->GetRawData(eip), (Instruction *) inst, eip);
+        cpbyte code = LxEmulator.Mem()->GetRawData(eip);
+        LxDecode(code, (Instruction *) inst, eip);
+        memcpy(inst->Code, code, min(inst->Length, Inst::MaxCodeSize));
         AttachApiInfo(cpu, eip, sec, inst, sections);
         updateIndex = true;
 
         u32 opcode = inst->Main.Inst.Opcode;
-        if (opcode == 0xc3 || opcode == 0xcb || opcode == 0xc2 || opcode == 0xca) {
+        if (Instruction::IsRet(inst)) {
             // 'ret' is met
             inst->Entry = entryEip;
             break;
@@ -224,11 +227,10 @@ void Disassembler::AttachApiInfo( const Processor *cpu, u32 eip, InstSection *se
 {
     u32 target = 0;
     u32 opcode = inst->Main.Inst.Opcode;
-    const char *mnemonic = inst->Main.Inst.Mnemonic;
 
     if (opcode == 0xff) {
         // CALL or JMP r/m32
-        if (strstr(mnemonic, "jmp") == mnemonic /*|| Instruction::IsCall(inst)*/) {
+        if (Instruction::IsIndirectJump(inst) /*|| Instruction::IsCall(inst)*/) {
             if (IsMemoryArg(inst->Main.Argument1) &&
                 inst->Main.Argument1.Memory.BaseRegister == 0 &&
                 inst->Main.Argument1.Memory.IndexRegister == 0 &&
@@ -249,13 +251,11 @@ void Disassembler::AttachApiInfo( const Processor *cpu, u32 eip, InstSection *se
             InstPtr instCalled = callSec->GetInst(target);
             Assert(instCalled != NULL);
 
-            if (instCalled->Main.Inst.Opcode == 0xff &&
-                (strstr(instCalled->Main.Inst.Mnemonic, "jmp") == instCalled->Main.Inst.Mnemonic)) 
-            {
+            if (Instruction::IsIndirectJump(instCalled)) {
                 target = cpu->ReadOperand32(instCalled, instCalled->Main.Argument1, NULL);
             }
         }
-    } else if (*mnemonic == 'j') {
+    } else if (Instruction::IsConditionalJump(inst) || Instruction::IsDirectJump(inst)) {
         target = (u32) inst->Main.Inst.AddrValue;
     }
 
@@ -284,6 +284,11 @@ void Disassembler::UpdateTContext( TContext *ctx, u32 eip ) const
     ctx->Inst = m_instMem.GetInst(eip);
 }
 
+void Disassembler::UpdateTraceContext( TraceContext *ctx, u32 eip ) const
+{
+    ctx->Inst = m_instMem.GetInst(eip);
+}
+
 InstPtr Disassembler::GetInst( u32 eip )
 {
     InstPtr pinst = m_instMem.GetInst(eip);
@@ -10,7 +10,9 @@
 
 struct Inst : public Instruction {
     static const int ApiInfoSize = 64;
+    static const int MaxCodeSize = 16;
     u32     Eip;
+    byte    Code[MaxCodeSize];  // copy of the bytes decoded, Main.EIP may not point at them later
     u32     Target;
     u32     Entry;
     char    TargetModuleName[ApiInfoSize];
@@ -19,6 +21,7 @@ struct Inst : public Instruction {
     std::string Desc;
 
     Inst() : Eip(0), Target(-1), Entry(-1), Index(-1) {
+        ZeroMemory(Code, sizeof(Code));
         ZeroMemory(TargetModuleName, sizeof(TargetModuleName));
         ZeroMemory(TargetFuncName, sizeof(TargetModuleName));
     }
@@ -112,6 +115,7 @@ public:
     InstPtr     Disassemble(const Processor *cpu, u32 eip);
     void        UpdateInstContext(InstContext *ctx, u32 eip) const;
     void        UpdateTContext(TContext *ctx, u32 eip) const;
+    void        UpdateTraceContext(TraceContext *ctx, u32 eip) const;
     InstPtr     GetInst(u32 eip);
     InstPtr     GetInst(const Processor *cpu, u32 eip);
     const InstSection * GetInstSection(u32 addr);